@@ -0,0 +1,370 @@
+/*******************************************************************************
+ * @file    os_bench.c
+ * @brief   Simple OS host micro-benchmarks
+ * @details Measures the scheduler's hot paths (OS_enAddTask(), OS_enDeleteTask(),
+ *          OS_vidUpdateTasks() and OS_vidDispatchTasks()) on the build host,
+ *          for the task count and tick width the benchmark was compiled with,
+ *          under different task load patterns.
+ *
+ *          Results are printed to stdout as a single JSON object:
+ *
+ *          ```json
+ *          {
+ *            "suite": "simple_os_host",
+ *            "config": {"task_count": 8, "tick_bits": 16, "compiler": "..."},
+ *            "results": [
+ *              {"op": "OS_vidUpdateTasks", "pattern": "all_due",
+ *               "ns_per_op": 12.3, "instructions_per_op": 95.0, "iterations": 50000},
+ *              ...
+ *            ]
+ *          }
+ *          ```
+ *
+ *          Instruction counts are read from the kernel's hardware performance
+ *          counters (perf_event_open()). When they are not available,
+ *          `instructions_per_op` is `null`.
+ * @date    18 Oct. 2026
+ * @author  Mohammad Mohsen
+ ******************************************************************************/
+
+#define _GNU_SOURCE
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#endif /*  __linux__  */
+
+#include "simple_os.h"
+
+/* ------------------------------------------------------------------------- */
+
+/**
+ * @brief Number of OS ticks in a single measurement, must be less than the
+ * 16-bit tick range so idle tasks never become due.
+ * */
+#define BENCH_TICKS             50000u
+
+/**
+ * @brief Number of OS ticks between two dispatches, when measuring the update
+ * alone. Must be less than the task's job counter range.
+ * */
+#define BENCH_UPDATE_BATCH      64u
+
+/**
+ * @brief Number of calls to OS_enAddTask() / OS_enDeleteTask() in a single measurement
+ * */
+#define BENCH_CALLS             200000u
+
+/**
+ * @brief Number of times each measurement is repeated, the fastest run is reported
+ * */
+#define BENCH_REPEAT            7u
+
+/**
+ * @brief Tick period/delay that is never reached during a single measurement
+ * */
+#define BENCH_IDLE_TICKS        60000u
+
+/* ------------------------------------------------------------------------- */
+
+/**
+ * @brief Task load pattern
+ * */
+typedef enum bench_pattern_t {
+    BENCH_PATTERN_IDLE,         /**<  All tasks are added, none of them is due  */
+    BENCH_PATTERN_ALL_DUE,      /**<  All tasks are added, all of them are due every tick  */
+    BENCH_PATTERN_STAGGERED,    /**<  All tasks are added, with different periods and offsets  */
+    BENCH_PATTERN_SPARSE,       /**<  A single task is added (lowest priority), due every tick  */
+    BENCH_PATTERN_COUNT,
+} Bench_Pattern_t;
+
+/**
+ * @brief A single measurement
+ * */
+typedef struct bench_sample_t {
+    double      ns;             /**<  Elapsed time in nanoseconds  */
+    double      instructions;   /**<  Retired instructions, negative if not available  */
+} Bench_Sample_t;
+
+/* ------------------------------------------------------------------------- */
+
+static const char * const bench_pattern_names [BENCH_PATTERN_COUNT] = {
+        [BENCH_PATTERN_IDLE]        = "idle",
+        [BENCH_PATTERN_ALL_DUE]     = "all_due",
+        [BENCH_PATTERN_STAGGERED]   = "staggered",
+        [BENCH_PATTERN_SPARSE]      = "sparse",
+};
+
+static OS_TaskHandle_t bench_handles [OS_TASK_COUNT];
+
+static volatile uint32_t bench_task_runs;
+
+static int bench_perf_fd = -1;
+
+static uint32_t bench_result_count;
+
+/* ------------------------------------------------------------------------- */
+
+static void bench_task(void * const args)
+{
+    (void)args;
+    bench_task_runs++;
+}
+
+static void bench_perf_open(void)
+{
+#ifdef __linux__
+    struct perf_event_attr attr;
+
+    memset(&attr, 0x00, sizeof(attr));
+    attr.type           = PERF_TYPE_HARDWARE;
+    attr.size           = sizeof(attr);
+    attr.config         = PERF_COUNT_HW_INSTRUCTIONS;
+    attr.disabled       = 1;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv     = 1;
+
+    bench_perf_fd = (int)syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0);
+#endif /*  __linux__  */
+}
+
+static uint64_t bench_now_ns(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return ((uint64_t)ts.tv_sec * 1000000000u) + (uint64_t)ts.tv_nsec;
+}
+
+static void bench_start(Bench_Sample_t * sample)
+{
+#ifdef __linux__
+    if(bench_perf_fd >= 0)
+    {
+        ioctl(bench_perf_fd, PERF_EVENT_IOC_RESET, 0);
+        ioctl(bench_perf_fd, PERF_EVENT_IOC_ENABLE, 0);
+    }
+#endif /*  __linux__  */
+
+    sample->ns = (double)bench_now_ns();
+}
+
+static void bench_stop(Bench_Sample_t * sample)
+{
+    uint64_t end_ns = bench_now_ns();
+    uint64_t count = 0;
+
+    sample->instructions = -1.0;
+
+#ifdef __linux__
+    if(bench_perf_fd >= 0)
+    {
+        ioctl(bench_perf_fd, PERF_EVENT_IOC_DISABLE, 0);
+
+        if(read(bench_perf_fd, &count, sizeof(count)) == (ssize_t)sizeof(count))
+        {
+            sample->instructions = (double)count;
+        }
+    }
+#endif /*  __linux__  */
+
+    sample->ns = (double)end_ns - sample->ns;
+}
+
+/* ------------------------------------------------------------------------- */
+
+static void bench_setup(Bench_Pattern_t pattern)
+{
+    uint32_t i;
+
+    OS_vidInitialize();
+
+    for(i = 0; i < OS_TASK_COUNT; i++)
+    {
+        switch(pattern)
+        {
+            case BENCH_PATTERN_IDLE:
+                OS_enAddTask(bench_task, NULL, i, BENCH_IDLE_TICKS, BENCH_IDLE_TICKS, &bench_handles[i]);
+                break;
+
+            case BENCH_PATTERN_ALL_DUE:
+                OS_enAddTask(bench_task, NULL, i, 1, 0, &bench_handles[i]);
+                break;
+
+            case BENCH_PATTERN_STAGGERED:
+                OS_enAddTask(bench_task, NULL, i, (OS_Tick_t)(1u << (i % 4u)) * 2u, (OS_Tick_t)i, &bench_handles[i]);
+                break;
+
+            case BENCH_PATTERN_SPARSE:
+                if(i == (OS_TASK_COUNT - 1))
+                {
+                    OS_enAddTask(bench_task, NULL, i, 1, 0, &bench_handles[i]);
+                }
+                break;
+
+            default:
+                break;
+        }
+    }
+}
+
+static void bench_emit(const char * op, const char * pattern, const Bench_Sample_t * sample, uint32_t iterations)
+{
+    printf("%s\n    {\"op\": \"%s\", \"pattern\": \"%s\", \"ns_per_op\": %.3f, \"instructions_per_op\": ",
+            (bench_result_count++ == 0) ? "" : ",", op, pattern, sample->ns / iterations);
+
+    if(sample->instructions < 0)
+    {
+        printf("null");
+    }
+    else
+    {
+        printf("%.2f", sample->instructions / iterations);
+    }
+
+    printf(", \"iterations\": %u}", iterations);
+}
+
+static void bench_keep_min(Bench_Sample_t * best, const Bench_Sample_t * sample)
+{
+    if((best->ns < 0) || (sample->ns < best->ns))
+    {
+        *best = *sample;
+    }
+}
+
+/* ------------------------------------------------------------------------- */
+
+static void bench_add_delete(void)
+{
+    Bench_Sample_t add_best = {-1.0, -1.0};
+    Bench_Sample_t pair_best = {-1.0, -1.0};
+    Bench_Sample_t sample;
+    uint32_t rep;
+    uint32_t i;
+
+    for(rep = 0; rep < BENCH_REPEAT; rep++)
+    {
+        OS_vidInitialize();
+
+        bench_start(&sample);
+        for(i = 0; i < BENCH_CALLS; i++)
+        {
+            OS_enAddTask(bench_task, NULL, i % OS_TASK_COUNT, 1, 0, &bench_handles[i % OS_TASK_COUNT]);
+        }
+        bench_stop(&sample);
+        bench_keep_min(&add_best, &sample);
+
+        OS_vidInitialize();
+
+        bench_start(&sample);
+        for(i = 0; i < BENCH_CALLS; i++)
+        {
+            OS_enAddTask(bench_task, NULL, i % OS_TASK_COUNT, 1, 0, &bench_handles[i % OS_TASK_COUNT]);
+            OS_enDeleteTask(bench_handles[i % OS_TASK_COUNT]);
+        }
+        bench_stop(&sample);
+        bench_keep_min(&pair_best, &sample);
+    }
+
+    bench_emit("OS_enAddTask", "round_robin", &add_best, BENCH_CALLS);
+
+    /*  delete cost = (add + delete) - add  */
+    pair_best.ns -= add_best.ns;
+    if((pair_best.instructions >= 0) && (add_best.instructions >= 0))
+    {
+        pair_best.instructions -= add_best.instructions;
+    }
+    bench_emit("OS_enDeleteTask", "round_robin", &pair_best, BENCH_CALLS);
+}
+
+static void bench_update_dispatch(Bench_Pattern_t pattern)
+{
+    Bench_Sample_t update_best = {-1.0, -1.0};
+    Bench_Sample_t tick_best = {-1.0, -1.0};
+    Bench_Sample_t sample;
+    Bench_Sample_t batch;
+    uint32_t rep;
+    uint32_t tick;
+    uint32_t i;
+
+    for(rep = 0; rep < BENCH_REPEAT; rep++)
+    {
+        /*  update alone, dispatch (untimed) after every batch of ticks  */
+        bench_setup(pattern);
+        sample.ns = 0;
+        sample.instructions = 0;
+
+        for(tick = 0; tick < BENCH_TICKS; tick += BENCH_UPDATE_BATCH)
+        {
+            bench_start(&batch);
+            for(i = 0; i < BENCH_UPDATE_BATCH; i++)
+            {
+                OS_vidUpdateTasks();
+            }
+            bench_stop(&batch);
+
+            OS_vidDispatchTasks();
+
+            sample.ns += batch.ns;
+            sample.instructions = (batch.instructions < 0) ? -1.0 : sample.instructions + batch.instructions;
+        }
+        bench_keep_min(&update_best, &sample);
+
+        /*  update followed by dispatch, every tick  */
+        bench_setup(pattern);
+
+        bench_start(&sample);
+        for(tick = 0; tick < BENCH_TICKS; tick++)
+        {
+            OS_vidUpdateTasks();
+            OS_vidDispatchTasks();
+        }
+        bench_stop(&sample);
+        bench_keep_min(&tick_best, &sample);
+    }
+
+    bench_emit("OS_vidUpdateTasks", bench_pattern_names[pattern], &update_best, BENCH_TICKS);
+
+    /*  dispatch cost = (update + dispatch) - update  */
+    tick_best.ns -= update_best.ns;
+    if((tick_best.instructions >= 0) && (update_best.instructions >= 0))
+    {
+        tick_best.instructions -= update_best.instructions;
+    }
+    bench_emit("OS_vidDispatchTasks", bench_pattern_names[pattern], &tick_best, BENCH_TICKS);
+}
+
+/* ------------------------------------------------------------------------- */
+
+int main(void)
+{
+    uint32_t pattern;
+
+    bench_perf_open();
+
+    printf("{\n  \"suite\": \"simple_os_host\",\n");
+    printf("  \"config\": {\"task_count\": %u, \"tick_bits\": %u, \"tick_rate_hz\": %u, \"compiler\": \"%s\"},\n",
+            (unsigned)OS_TASK_COUNT, (unsigned)(sizeof(OS_Tick_t) * 8u), (unsigned)OS_TICK_RATE_HZ, __VERSION__);
+    printf("  \"results\": [");
+
+    bench_add_delete();
+
+    for(pattern = 0; pattern < BENCH_PATTERN_COUNT; pattern++)
+    {
+        bench_update_dispatch((Bench_Pattern_t)pattern);
+    }
+
+    printf("\n  ]\n}\n");
+
+    return 0;
+}
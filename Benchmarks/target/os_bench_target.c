@@ -0,0 +1,1064 @@
+/*******************************************************************************
+ * @file    os_bench_target.c
+ * @brief   Simple OS on-target benchmark firmware
+ * @details Replaces the application's main.c, runs synthetic task tables
+ *          through the scheduler and measures, in core clock cycles:
+ *          - OS_vidUpdateTasks() called directly
+ *          - SysTick_Handler(): the tick interrupt, including exception entry and exit
+ *          - OS_vidDispatchTasks() dispatching the tasks released by one tick
+ *
+ *          Cycles are read from the DWT cycle counter (DWT->CYCCNT). When built
+ *          with `BENCH_QEMU` (QEMU doesn't model the DWT), the free running
+ *          SysTick down counter is used instead.
+ *
+ *          Results are sent over USART1 (PA9, 115200 8N1) as a single JSON object:
+ *
+ *          ```json
+ *          {
+ *            "suite": "simple_os_target",
+ *            "config": {"task_count": 8, "tick_bits": 16, "core_clock_hz": 8000000, "cycle_source": "dwt"},
+ *            "results": [
+ *              {"op": "OS_vidUpdateTasks", "pattern": "all_due",
+ *               "cycles_min": 120, "cycles_mean": 124, "cycles_max": 131, "iterations": 1000},
+ *              ...
+ *            ]
+ *          }
+ *          ```
+ *
+ *          The ready flags in use are reported in the configuration (`"ready_flags"`):
+ *          `"counter"` (per-task job counters, default) or `"bitband"` (`CONF_OS_USE_BITBAND_READY=1`,
+ *          ready bits set and cleared through the SRAM bit-band alias). Build the firmware
+ *          both ways to compare the update, tick and dispatch costs of both.
+ *
+ *          The DMA USART transmit channel (uart_tx.h) is measured at each baud rate
+ *          up to PCLK2 / 16 (not under QEMU, and only with `CONF_UART_USE_TX_DMA=1`): throughput and CPU cycles per KB, counting
+ *          reserve/commit calls and the DMA interrupt (instrumented through irq.h).
+ *          The payload is kept off the wire (PA9 driven high as a GPIO):
+ *
+ *          ```json
+ *          {"op": "UART_tx", "baudrate": 460800, "bytes": 8192, "cycles": 1424000,
+ *           "bytes_per_sec": 46022, "cpu_cycles_per_kb": 1530, "dma_transfers": 31}
+ *          ```
+ *
+ *          The binary logger (log.h) write cost is measured with 0 and 2 arguments
+ *          (op `LOG_vidWrite`, patterns `args_0` and `args_2`).
+ *
+ *          The formatter (fmt.h) is measured against newlib-nano's snprintf() with the
+ *          same output (ops `FMT` and `snprintf`): a single unsigned number (pattern `u32`),
+ *          a line mixing signed, hexadecimal and padded fields (pattern `format`), and
+ *          a Q16.16 number with 3 decimals (pattern `fixed`; snprintf() is given the integer
+ *          and fraction parts, as newlib-nano has no floating point printf by default).
+ *
+ *          The queues (queue.h) push and pop costs are measured for a word item (ops
+ *          `queue_push` and `queue_pop`), lock-free SPSC and MPSC queues (patterns `spsc`
+ *          and `mpsc`) against a queue protected by masking interrupts (pattern
+ *          `critical_section`).
+ *
+ *          The sequence lock (seqlock.h) write and read costs are measured for a 16 bytes
+ *          value (ops `shared_write` and `shared_read`, pattern `seqlock`) against a copy
+ *          with interrupts masked (pattern `critical_section`).
+ *
+ *          When built with threads (`CONF_OS_USE_THREADS=1`, CMake option `BENCH_THREADS`),
+ *          the context switch is measured by a thread yielding at each dispatch pass, against
+ *          a task releasing itself: from OS_vidDispatchTasks() to the first instruction of the
+ *          thread or task (op `context_switch_in`), and from the yield to OS_vidDispatchTasks()'
+ *          return (op `context_switch_out`), patterns `thread` and `task`. The difference between
+ *          the patterns is the cost of the PendSV switches.
+ *
+ *          When built with `BENCH_QEMU`, the firmware exits QEMU through
+ *          semihosting once the report is sent (run QEMU with `-semihosting`).
+ * @date    18 Oct. 2026
+ * @author  Mohammad Mohsen
+ ******************************************************************************/
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "main.h"
+
+#include "utils/utils.h"
+
+#include "simple_os.h"
+
+#include "irq/irq.h"
+#include "uart/uart_tx.h"
+#include "log/log.h"
+#include "utils/fmt.h"
+#include "queue/queue.h"
+#include "seqlock/seqlock.h"
+
+#include "simple_os_thread.h"
+
+/* ------------------------------------------------------------------------- */
+
+/**
+ * @brief Number of measured ticks per task pattern
+ * */
+#define BENCH_TICKS             1000u
+
+/**
+ * @brief Tick period/delay that is never reached during a single measurement
+ * */
+#define BENCH_IDLE_TICKS        60000u
+
+/**
+ * @brief Size of the formatting benchmark's output buffer
+ * */
+#define BENCH_FMT_SIZE          48u
+
+/**
+ * @brief Number of items of the benchmark queues
+ * */
+#define BENCH_QUEUE_SIZE        16u
+
+/**
+ * @brief USART1 baud rate used to send the report
+ * */
+#define BENCH_BAUDRATE          115200u
+
+/**
+ * @brief Bytes sent through the DMA transmit channel, per baud rate
+ * */
+#define BENCH_UART_BYTES        8192u
+
+/**
+ * @brief Size of a single reservation of the DMA transmit channel
+ * */
+#define BENCH_UART_CHUNK        64u
+
+/* ------------------------------------------------------------------------- */
+
+/**
+ * @brief Task load pattern
+ * */
+typedef enum bench_pattern_t {
+    BENCH_PATTERN_IDLE,         /**<  All tasks are added, none of them is due  */
+    BENCH_PATTERN_ALL_DUE,      /**<  All tasks are added, all of them are due every tick  */
+    BENCH_PATTERN_STAGGERED,    /**<  All tasks are added, with different periods and offsets  */
+    BENCH_PATTERN_SPARSE,       /**<  A single task is added (lowest priority), due every tick  */
+    BENCH_PATTERN_COUNT,
+} Bench_Pattern_t;
+
+/**
+ * @brief Cycle statistics of a single operation
+ * */
+typedef struct bench_stats_t {
+    uint32_t    min;            /**<  Minimum cycles  */
+    uint32_t    max;            /**<  Maximum cycles  */
+    uint64_t    sum;            /**<  Total cycles  */
+    uint32_t    count;          /**<  Number of measurements  */
+} Bench_Stats_t;
+
+/**
+ * @brief Reference queue, protected by masking interrupts
+ * */
+typedef struct bench_cs_queue_t {
+    uint32_t    items [BENCH_QUEUE_SIZE];   /**<  Items  */
+    uint32_t    write;                      /**<  Write index  */
+    uint32_t    read;                       /**<  Read index  */
+    uint32_t    count;                      /**<  Number of items  */
+} Bench_CsQueue_t;
+
+/**
+ * @brief Value shared through the sequence lock
+ * */
+typedef struct bench_shared_t {
+    uint32_t    timestamp;      /**<  Timestamp  */
+    int32_t     sample [3];     /**<  Sample  */
+} Bench_Shared_t;
+
+SEQLOCK_DECLARE(bench_shared, Bench_Shared_t)
+
+/* ------------------------------------------------------------------------- */
+
+static const char * const bench_pattern_names [BENCH_PATTERN_COUNT] = {
+        [BENCH_PATTERN_IDLE]        = "idle",
+        [BENCH_PATTERN_ALL_DUE]     = "all_due",
+        [BENCH_PATTERN_STAGGERED]   = "staggered",
+        [BENCH_PATTERN_SPARSE]      = "sparse",
+};
+
+#if !defined(BENCH_QEMU) && UART_USE_TX_DMA
+static const uint32_t bench_uart_baudrates [] = {
+        115200u, 230400u, 460800u, 500000u, 1000000u, 2000000u,
+};
+#endif /*  !BENCH_QEMU && UART_USE_TX_DMA  */
+
+static OS_TaskHandle_t bench_handles [OS_TASK_COUNT];
+
+static volatile uint32_t bench_task_runs;
+
+static uint32_t bench_overhead;
+
+static uint32_t bench_result_count;
+
+QUEUE_SPSC_DEFINE(bench_spsc_queue, uint32_t, BENCH_QUEUE_SIZE);
+
+QUEUE_MPSC_DEFINE(bench_mpsc_queue, uint32_t, BENCH_QUEUE_SIZE);
+
+static Bench_CsQueue_t bench_cs_queue;
+
+SEQLOCK_DEFINE(bench_shared);
+
+static Bench_Shared_t bench_cs_shared;
+
+/* ------------------------------------------------------------------------- */
+
+void SystemClock_Config(void);
+
+/* ------------------------------------------------------------------------- */
+
+static inline uint32_t bench_cycles(void)
+{
+#ifdef BENCH_QEMU
+    return SysTick->VAL;
+#else
+    return DWT->CYCCNT;
+#endif /*  BENCH_QEMU  */
+}
+
+static inline uint32_t bench_elapsed(uint32_t start, uint32_t end)
+{
+#ifdef BENCH_QEMU
+    /*  SysTick is a 24-bit down counter  */
+    return (start - end) & SysTick_LOAD_RELOAD_Msk;
+#else
+    return end - start;
+#endif /*  BENCH_QEMU  */
+}
+
+static void bench_cycles_init(void)
+{
+#ifdef BENCH_QEMU
+    SysTick->LOAD = SysTick_LOAD_RELOAD_Msk;
+    SysTick->VAL  = 0UL;
+    SysTick->CTRL = SysTick_CTRL_CLKSOURCE_Msk | SysTick_CTRL_ENABLE_Msk;
+#else
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CYCCNT = 0;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+#endif /*  BENCH_QEMU  */
+}
+
+/* ------------------------------------------------------------------------- */
+
+static void bench_usart_init(void)
+{
+    LL_GPIO_InitTypeDef GPIO_InitStruct = {0};
+    LL_USART_InitTypeDef USART_InitStruct = {0};
+
+    LL_APB2_GRP1_EnableClock(LL_APB2_GRP1_PERIPH_USART1);
+    LL_APB2_GRP1_EnableClock(LL_APB2_GRP1_PERIPH_GPIOA);
+
+    /*  USART must be disabled to be (re)configured  */
+    LL_USART_Disable(USART1);
+
+    /*  USART1 TX: PA9  */
+    GPIO_InitStruct.Pin         = LL_GPIO_PIN_9;
+    GPIO_InitStruct.Mode        = LL_GPIO_MODE_ALTERNATE;
+    GPIO_InitStruct.Speed       = LL_GPIO_SPEED_FREQ_HIGH;
+    GPIO_InitStruct.OutputType  = LL_GPIO_OUTPUT_PUSHPULL;
+    LL_GPIO_Init(GPIOA, &GPIO_InitStruct);
+
+    LL_USART_StructInit(&USART_InitStruct);
+    USART_InitStruct.BaudRate           = BENCH_BAUDRATE;
+    USART_InitStruct.TransferDirection  = LL_USART_DIRECTION_TX;
+    LL_USART_Init(USART1, &USART_InitStruct);
+    LL_USART_ConfigAsyncMode(USART1);
+    LL_USART_Enable(USART1);
+}
+
+static void bench_putc(char c)
+{
+    while(!LL_USART_IsActiveFlag_TXE(USART1))
+    {
+    }
+
+    LL_USART_TransmitData8(USART1, (uint8_t)c);
+}
+
+static void bench_puts(const char * str)
+{
+    while(*str)
+    {
+        bench_putc(*str++);
+    }
+}
+
+static void bench_put_u32(uint32_t value)
+{
+    char buffer [10];
+    uint32_t len = 0;
+
+    do
+    {
+        buffer[len++] = (char)('0' + (value % 10u));
+        value /= 10u;
+    } while(value);
+
+    while(len)
+    {
+        bench_putc(buffer[--len]);
+    }
+}
+
+static void bench_flush(void)
+{
+    while(!LL_USART_IsActiveFlag_TC(USART1))
+    {
+    }
+}
+
+/* ------------------------------------------------------------------------- */
+
+static void bench_stats_reset(Bench_Stats_t * stats)
+{
+    stats->min      = UINT32_MAX;
+    stats->max      = 0;
+    stats->sum      = 0;
+    stats->count    = 0;
+}
+
+static void bench_stats_add(Bench_Stats_t * stats, uint32_t cycles)
+{
+    cycles = (cycles > bench_overhead) ? (cycles - bench_overhead) : 0;
+
+    stats->min = MIN(stats->min, cycles);
+    stats->max = MAX(stats->max, cycles);
+    stats->sum += cycles;
+    stats->count++;
+}
+
+static void bench_emit(const char * op, const char * pattern, const Bench_Stats_t * stats)
+{
+    bench_puts((bench_result_count++ == 0) ? "\r\n" : ",\r\n");
+    bench_puts("    {\"op\": \"");
+    bench_puts(op);
+    bench_puts("\", \"pattern\": \"");
+    bench_puts(pattern);
+    bench_puts("\", \"cycles_min\": ");
+    bench_put_u32(stats->min);
+    bench_puts(", \"cycles_mean\": ");
+    bench_put_u32((uint32_t)(stats->sum / stats->count));
+    bench_puts(", \"cycles_max\": ");
+    bench_put_u32(stats->max);
+    bench_puts(", \"iterations\": ");
+    bench_put_u32(stats->count);
+    bench_puts("}");
+}
+
+/* ------------------------------------------------------------------------- */
+
+static void bench_task(void * const args)
+{
+    (void)args;
+    bench_task_runs++;
+}
+
+static void bench_setup(Bench_Pattern_t pattern)
+{
+    uint32_t i;
+
+    OS_vidInitialize();
+
+    for(i = 0; i < OS_TASK_COUNT; i++)
+    {
+        switch(pattern)
+        {
+            case BENCH_PATTERN_IDLE:
+                OS_enAddTask(bench_task, NULL, i, BENCH_IDLE_TICKS, BENCH_IDLE_TICKS, &bench_handles[i]);
+                break;
+
+            case BENCH_PATTERN_ALL_DUE:
+                OS_enAddTask(bench_task, NULL, i, 1, 0, &bench_handles[i]);
+                break;
+
+            case BENCH_PATTERN_STAGGERED:
+                OS_enAddTask(bench_task, NULL, i, (OS_Tick_t)(1u << (i % 4u)) * 2u, (OS_Tick_t)i, &bench_handles[i]);
+                break;
+
+            case BENCH_PATTERN_SPARSE:
+                if(i == (OS_TASK_COUNT - 1))
+                {
+                    OS_enAddTask(bench_task, NULL, i, 1, 0, &bench_handles[i]);
+                }
+                break;
+
+            default:
+                break;
+        }
+    }
+}
+
+static void bench_calibrate(void)
+{
+    uint32_t start;
+    uint32_t end;
+    uint32_t i;
+
+    bench_overhead = UINT32_MAX;
+
+    for(i = 0; i < 16u; i++)
+    {
+        start = bench_cycles();
+        __asm__ volatile ("" : : : "memory");
+        end = bench_cycles();
+
+        bench_overhead = MIN(bench_overhead, bench_elapsed(start, end));
+    }
+}
+
+static void bench_add_delete(void)
+{
+    Bench_Stats_t add_stats;
+    Bench_Stats_t delete_stats;
+    uint32_t start;
+    uint32_t end;
+    uint32_t i;
+
+    bench_stats_reset(&add_stats);
+    bench_stats_reset(&delete_stats);
+
+    OS_vidInitialize();
+
+    for(i = 0; i < BENCH_TICKS; i++)
+    {
+        start = bench_cycles();
+        OS_enAddTask(bench_task, NULL, i % OS_TASK_COUNT, 1, 0, &bench_handles[i % OS_TASK_COUNT]);
+        end = bench_cycles();
+        bench_stats_add(&add_stats, bench_elapsed(start, end));
+
+        start = bench_cycles();
+        OS_enDeleteTask(bench_handles[i % OS_TASK_COUNT]);
+        end = bench_cycles();
+        bench_stats_add(&delete_stats, bench_elapsed(start, end));
+    }
+
+    bench_emit("OS_enAddTask", "round_robin", &add_stats);
+    bench_emit("OS_enDeleteTask", "round_robin", &delete_stats);
+}
+
+static void bench_tick(Bench_Pattern_t pattern)
+{
+    Bench_Stats_t update_stats;
+    Bench_Stats_t isr_stats;
+    Bench_Stats_t dispatch_stats;
+    uint32_t start;
+    uint32_t end;
+    uint32_t tick;
+
+    bench_stats_reset(&update_stats);
+    bench_stats_reset(&isr_stats);
+    bench_stats_reset(&dispatch_stats);
+
+    /*  OS_vidUpdateTasks() called directly, followed by a dispatch  */
+    bench_setup(pattern);
+
+    for(tick = 0; tick < BENCH_TICKS; tick++)
+    {
+        start = bench_cycles();
+        OS_vidUpdateTasks();
+        end = bench_cycles();
+        bench_stats_add(&update_stats, bench_elapsed(start, end));
+
+        start = bench_cycles();
+        OS_vidDispatchTasks();
+        end = bench_cycles();
+        bench_stats_add(&dispatch_stats, bench_elapsed(start, end));
+    }
+
+    /*  OS_vidUpdateTasks() called from the tick interrupt (pended by software)  */
+    bench_setup(pattern);
+
+    for(tick = 0; tick < BENCH_TICKS; tick++)
+    {
+        start = bench_cycles();
+        SCB->ICSR = SCB_ICSR_PENDSTSET_Msk;
+        __DSB();
+        __ISB();
+        end = bench_cycles();
+        bench_stats_add(&isr_stats, bench_elapsed(start, end));
+
+        OS_vidDispatchTasks();
+    }
+
+    bench_emit("OS_vidUpdateTasks", bench_pattern_names[pattern], &update_stats);
+    bench_emit("SysTick_Handler", bench_pattern_names[pattern], &isr_stats);
+    bench_emit("OS_vidDispatchTasks", bench_pattern_names[pattern], &dispatch_stats);
+}
+
+static void bench_log(void)
+{
+    Bench_Stats_t args0_stats;
+    Bench_Stats_t args2_stats;
+    uint32_t start;
+    uint32_t end;
+    uint32_t i;
+
+    bench_stats_reset(&args0_stats);
+    bench_stats_reset(&args2_stats);
+
+    for(i = 0; i < BENCH_TICKS; i++)
+    {
+        /*  records are discarded before the ring buffer is full  */
+        if(IS_ZERO(i % (LOG_BUFFER_WORDS / 8u)))
+        {
+            LOG_vidReset();
+        }
+
+        start = bench_cycles();
+        LOG_ERROR("bench");
+        end = bench_cycles();
+        bench_stats_add(&args0_stats, bench_elapsed(start, end));
+
+        start = bench_cycles();
+        LOG_ERROR("bench %u %u", i, end);
+        end = bench_cycles();
+        bench_stats_add(&args2_stats, bench_elapsed(start, end));
+    }
+
+    LOG_vidReset();
+
+    bench_emit("LOG_vidWrite", "args_0", &args0_stats);
+    bench_emit("LOG_vidWrite", "args_2", &args2_stats);
+}
+
+static void bench_fmt(void)
+{
+    static char buffer [BENCH_FMT_SIZE];
+    Bench_Stats_t fmt_stats [3];
+    Bench_Stats_t printf_stats [3];
+    uint32_t value;
+    int32_t fixed;
+    uint32_t start;
+    uint32_t end;
+    uint32_t i;
+
+    for(i = 0; i < 3u; i++)
+    {
+        bench_stats_reset(&fmt_stats[i]);
+        bench_stats_reset(&printf_stats[i]);
+    }
+
+    for(i = 0; i < BENCH_TICKS; i++)
+    {
+        /*  spread over all the number sizes  */
+        value = (i * 2654435761u) >> (i % 32u);
+        fixed = (int32_t)value;
+
+        start = bench_cycles();
+        FMT_u32Unsigned(buffer, value);
+        end = bench_cycles();
+        bench_stats_add(&fmt_stats[0], bench_elapsed(start, end));
+
+        start = bench_cycles();
+        snprintf(buffer, sizeof(buffer), "%lu", (unsigned long)value);
+        end = bench_cycles();
+        bench_stats_add(&printf_stats[0], bench_elapsed(start, end));
+
+        start = bench_cycles();
+        FMT_u32Format(buffer, sizeof(buffer), "t=%u id=%08x v=%6d %s", i, value, fixed >> 8, "ok");
+        end = bench_cycles();
+        bench_stats_add(&fmt_stats[1], bench_elapsed(start, end));
+
+        start = bench_cycles();
+        snprintf(buffer, sizeof(buffer), "t=%u id=%08lx v=%6ld %s", (unsigned int)i, (unsigned long)value, (long)(fixed >> 8), "ok");
+        end = bench_cycles();
+        bench_stats_add(&printf_stats[1], bench_elapsed(start, end));
+
+        start = bench_cycles();
+        FMT_u32Fixed(buffer, fixed, 16u, 3u);
+        end = bench_cycles();
+        bench_stats_add(&fmt_stats[2], bench_elapsed(start, end));
+
+        /*  truncated, not rounded: the cost of the conversion is what is measured  */
+        start = bench_cycles();
+        snprintf(buffer, sizeof(buffer), "%s%lu.%03lu", (fixed < 0) ? "-" : "",
+                 (unsigned long)(((fixed < 0) ? (0u - value) : value) >> 16),
+                 (unsigned long)(((((fixed < 0) ? (0u - value) : value) & 0xFFFFu) * 1000u) >> 16));
+        end = bench_cycles();
+        bench_stats_add(&printf_stats[2], bench_elapsed(start, end));
+    }
+
+    bench_emit("FMT", "u32", &fmt_stats[0]);
+    bench_emit("snprintf", "u32", &printf_stats[0]);
+    bench_emit("FMT", "format", &fmt_stats[1]);
+    bench_emit("snprintf", "format", &printf_stats[1]);
+    bench_emit("FMT", "fixed", &fmt_stats[2]);
+    bench_emit("snprintf", "fixed", &printf_stats[2]);
+}
+
+/*  not inlined, as the queue library functions  */
+static uint32_t __attribute__((noinline)) bench_cs_push(Bench_CsQueue_t * queue, uint32_t item)
+{
+    uint32_t primask = __get_PRIMASK();
+    uint32_t pushed = FALSE;
+
+    __disable_irq();
+
+    if(queue->count < BENCH_QUEUE_SIZE)
+    {
+        queue->items[queue->write] = item;
+        queue->write = (queue->write + 1u) % BENCH_QUEUE_SIZE;
+        queue->count++;
+        pushed = TRUE;
+    }
+
+    __set_PRIMASK(primask);
+
+    return pushed;
+}
+
+static uint32_t __attribute__((noinline)) bench_cs_pop(Bench_CsQueue_t * queue, uint32_t * item)
+{
+    uint32_t primask = __get_PRIMASK();
+    uint32_t popped = FALSE;
+
+    __disable_irq();
+
+    if(queue->count)
+    {
+        *item = queue->items[queue->read];
+        queue->read = (queue->read + 1u) % BENCH_QUEUE_SIZE;
+        queue->count--;
+        popped = TRUE;
+    }
+
+    __set_PRIMASK(primask);
+
+    return popped;
+}
+
+static void bench_queue(void)
+{
+    Bench_Stats_t push_stats [3];
+    Bench_Stats_t pop_stats [3];
+    uint32_t item;
+    uint32_t start;
+    uint32_t end;
+    uint32_t i;
+
+    for(i = 0; i < 3u; i++)
+    {
+        bench_stats_reset(&push_stats[i]);
+        bench_stats_reset(&pop_stats[i]);
+    }
+
+    for(i = 0; i < BENCH_TICKS; i++)
+    {
+        start = bench_cycles();
+        QUEUE_u32SpscPush(&bench_spsc_queue, &i);
+        end = bench_cycles();
+        bench_stats_add(&push_stats[0], bench_elapsed(start, end));
+
+        start = bench_cycles();
+        QUEUE_u32SpscPop(&bench_spsc_queue, &item);
+        end = bench_cycles();
+        bench_stats_add(&pop_stats[0], bench_elapsed(start, end));
+
+        start = bench_cycles();
+        QUEUE_u32MpscPush(&bench_mpsc_queue, &i);
+        end = bench_cycles();
+        bench_stats_add(&push_stats[1], bench_elapsed(start, end));
+
+        start = bench_cycles();
+        QUEUE_u32MpscPop(&bench_mpsc_queue, &item);
+        end = bench_cycles();
+        bench_stats_add(&pop_stats[1], bench_elapsed(start, end));
+
+        start = bench_cycles();
+        bench_cs_push(&bench_cs_queue, i);
+        end = bench_cycles();
+        bench_stats_add(&push_stats[2], bench_elapsed(start, end));
+
+        start = bench_cycles();
+        bench_cs_pop(&bench_cs_queue, &item);
+        end = bench_cycles();
+        bench_stats_add(&pop_stats[2], bench_elapsed(start, end));
+    }
+
+    bench_emit("queue_push", "spsc", &push_stats[0]);
+    bench_emit("queue_pop", "spsc", &pop_stats[0]);
+    bench_emit("queue_push", "mpsc", &push_stats[1]);
+    bench_emit("queue_pop", "mpsc", &pop_stats[1]);
+    bench_emit("queue_push", "critical_section", &push_stats[2]);
+    bench_emit("queue_pop", "critical_section", &pop_stats[2]);
+}
+
+/*  not inlined, as the sequence lock functions  */
+static void __attribute__((noinline)) bench_cs_copy(void * destination, const void * source)
+{
+    uint32_t primask = __get_PRIMASK();
+
+    __disable_irq();
+    memcpy(destination, source, sizeof(Bench_Shared_t));
+    __set_PRIMASK(primask);
+}
+
+static void bench_seqlock(void)
+{
+    Bench_Stats_t write_stats [2];
+    Bench_Stats_t read_stats [2];
+    Bench_Shared_t value = { 0 };
+    uint32_t start;
+    uint32_t end;
+    uint32_t i;
+
+    for(i = 0; i < 2u; i++)
+    {
+        bench_stats_reset(&write_stats[i]);
+        bench_stats_reset(&read_stats[i]);
+    }
+
+    for(i = 0; i < BENCH_TICKS; i++)
+    {
+        value.timestamp = i;
+
+        start = bench_cycles();
+        bench_shared_vidWrite(&value);
+        end = bench_cycles();
+        bench_stats_add(&write_stats[0], bench_elapsed(start, end));
+
+        start = bench_cycles();
+        bench_shared_u32Read(&value);
+        end = bench_cycles();
+        bench_stats_add(&read_stats[0], bench_elapsed(start, end));
+
+        start = bench_cycles();
+        bench_cs_copy(&bench_cs_shared, &value);
+        end = bench_cycles();
+        bench_stats_add(&write_stats[1], bench_elapsed(start, end));
+
+        start = bench_cycles();
+        bench_cs_copy(&value, &bench_cs_shared);
+        end = bench_cycles();
+        bench_stats_add(&read_stats[1], bench_elapsed(start, end));
+    }
+
+    bench_emit("shared_write", "seqlock", &write_stats[0]);
+    bench_emit("shared_read", "seqlock", &read_stats[0]);
+    bench_emit("shared_write", "critical_section", &write_stats[1]);
+    bench_emit("shared_read", "critical_section", &read_stats[1]);
+}
+
+#if OS_USE_THREADS
+
+OS_THREAD_DEFINE(bench_thread_ctx, 256);
+
+static volatile uint32_t bench_switch_in;
+
+static volatile uint32_t bench_switch_out;
+
+static void bench_yield_task(void * const args)
+{
+    (void)args;
+    bench_switch_in = bench_cycles();
+
+    bench_switch_out = bench_cycles();
+    OS_enReadyTask(bench_handles[0]);
+}
+
+static void bench_yield_thread(void * const args)
+{
+    (void)args;
+
+    for(;;)
+    {
+        bench_switch_in = bench_cycles();
+
+        bench_switch_out = bench_cycles();
+        OS_vidThreadYield();
+    }
+}
+
+static void bench_switch(Bench_Stats_t * in_stats, Bench_Stats_t * out_stats)
+{
+    uint32_t start;
+    uint32_t end;
+    uint32_t i;
+
+    bench_stats_reset(in_stats);
+    bench_stats_reset(out_stats);
+
+    /*  first execution starts the thread  */
+    OS_vidDispatchTasks();
+
+    for(i = 0; i < BENCH_TICKS; i++)
+    {
+        start = bench_cycles();
+        OS_vidDispatchTasks();
+        end = bench_cycles();
+
+        bench_stats_add(in_stats, bench_elapsed(start, bench_switch_in));
+        bench_stats_add(out_stats, bench_elapsed(bench_switch_out, end));
+    }
+}
+
+static void bench_thread(void)
+{
+    Bench_Stats_t in_stats [2];
+    Bench_Stats_t out_stats [2];
+
+    OS_vidInitialize();
+    OS_enAddEventTask(bench_yield_task, NULL, 0, &bench_handles[0]);
+    OS_enReadyTask(bench_handles[0]);
+    bench_switch(&in_stats[0], &out_stats[0]);
+
+    OS_vidInitialize();
+    OS_enAddThread(&bench_thread_ctx, bench_yield_thread, NULL, 0, 0, &bench_handles[0]);
+    bench_switch(&in_stats[1], &out_stats[1]);
+
+    bench_emit("context_switch_in", "task", &in_stats[0]);
+    bench_emit("context_switch_out", "task", &out_stats[0]);
+    bench_emit("context_switch_in", "thread", &in_stats[1]);
+    bench_emit("context_switch_out", "thread", &out_stats[1]);
+}
+
+#endif /*  OS_USE_THREADS  */
+
+#if !defined(BENCH_QEMU) && UART_USE_TX_DMA
+
+static void bench_emit_uart(uint32_t baudrate, uint32_t cycles, uint64_t cpu_cycles, uint32_t transfers)
+{
+    bench_puts((bench_result_count++ == 0) ? "\r\n" : ",\r\n");
+    bench_puts("    {\"op\": \"UART_tx\", \"baudrate\": ");
+    bench_put_u32(baudrate);
+    bench_puts(", \"bytes\": ");
+    bench_put_u32(BENCH_UART_BYTES);
+    bench_puts(", \"cycles\": ");
+    bench_put_u32(cycles);
+    bench_puts(", \"bytes_per_sec\": ");
+    bench_put_u32((uint32_t)(((uint64_t)BENCH_UART_BYTES * SystemCoreClock) / cycles));
+    bench_puts(", \"cpu_cycles_per_kb\": ");
+    bench_put_u32((uint32_t)((cpu_cycles * 1024u) / BENCH_UART_BYTES));
+    bench_puts(", \"dma_transfers\": ");
+    bench_put_u32(transfers);
+    bench_puts("}");
+}
+
+static void bench_uart_tx(void)
+{
+    LL_RCC_ClocksTypeDef clocks;
+    IRQ_Stats_t irq_stats;
+    UART_TxStats_t tx_stats;
+    uint8_t * buffer;
+    uint64_t cpu_cycles;
+    uint32_t start;
+    uint32_t end;
+    uint32_t reserve_start;
+    uint32_t reserve_end;
+    uint32_t commit_start;
+    uint32_t commit_end;
+    uint32_t sent;
+    uint32_t i;
+
+    LL_RCC_GetSystemClocksFreq(&clocks);
+
+    /*  DMA interrupt cycles are measured by the instrumented trampoline  */
+    IRQ_vidRelocateVectorTable();
+    IRQ_enInstrument(DMA1_Channel4_IRQn, 1);
+
+    bench_flush();
+
+    for(i = 0; i < (sizeof(bench_uart_baudrates) / sizeof(bench_uart_baudrates[0])); i++)
+    {
+        if(bench_uart_baudrates[i] > (clocks.PCLK2_Frequency / 16u))
+        {
+            continue;
+        }
+
+        UART_vidTxInit(bench_uart_baudrates[i]);
+
+        /*  keep the payload off the wire (report is sent at BENCH_BAUDRATE)  */
+        LL_GPIO_SetOutputPin(GPIOA, LL_GPIO_PIN_9);
+        LL_GPIO_SetPinMode(GPIOA, LL_GPIO_PIN_9, LL_GPIO_MODE_OUTPUT);
+
+        IRQ_vidResetStats();
+        cpu_cycles  = 0;
+        sent        = 0;
+
+        start = bench_cycles();
+
+        while(sent < BENCH_UART_BYTES)
+        {
+            reserve_start = bench_cycles();
+            buffer = UART_pu8TxReserve(BENCH_UART_CHUNK);
+            reserve_end = bench_cycles();
+
+            if(IS_NULLPTR(buffer))
+            {
+                continue;
+            }
+
+            buffer[0] = (uint8_t)sent;
+
+            commit_start = bench_cycles();
+            UART_vidTxCommit(BENCH_UART_CHUNK);
+            commit_end = bench_cycles();
+
+            cpu_cycles += bench_elapsed(reserve_start, reserve_end) + bench_elapsed(commit_start, commit_end);
+            sent += BENCH_UART_CHUNK;
+        }
+
+        while(UART_u32TxPending())
+        {
+        }
+
+        bench_flush();
+
+        end = bench_cycles();
+
+        IRQ_enGetStats(DMA1_Channel4_IRQn, &irq_stats);
+        UART_vidTxGetStats(&tx_stats);
+
+        /*  back to the polled report output  */
+        UART_vidTxDeinit();
+        bench_usart_init();
+        bench_emit_uart(bench_uart_baudrates[i], bench_elapsed(start, end), cpu_cycles + irq_stats.cycles, tx_stats.transfers);
+        bench_flush();
+    }
+
+    IRQ_enInstrument(DMA1_Channel4_IRQn, 0);
+}
+
+#endif /*  !BENCH_QEMU && UART_USE_TX_DMA  */
+
+static void bench_exit(void)
+{
+#ifdef BENCH_QEMU
+    /*  semihosting SYS_EXIT, reason ADP_Stopped_ApplicationExit  */
+    register uint32_t r0 __asm__("r0") = 0x18u;
+    register uint32_t r1 __asm__("r1") = 0x20026u;
+
+    __asm__ volatile ("bkpt 0xAB" : : "r" (r0), "r" (r1) : "memory");
+#endif /*  BENCH_QEMU  */
+
+    while(1)
+    {
+    }
+}
+
+/* ------------------------------------------------------------------------- */
+
+int main(void)
+{
+    uint32_t pattern;
+
+    LL_APB2_GRP1_EnableClock(LL_APB2_GRP1_PERIPH_AFIO);
+    LL_APB1_GRP1_EnableClock(LL_APB1_GRP1_PERIPH_PWR);
+
+    NVIC_SetPriorityGrouping(NVIC_PRIORITYGROUP_4);
+    NVIC_SetPriority(SysTick_IRQn, NVIC_EncodePriority(NVIC_GetPriorityGrouping(), 15, 0));
+
+    LL_GPIO_AF_Remap_SWJ_NOJTAG();
+
+#ifndef BENCH_QEMU
+    /*  QEMU doesn't model the RCC, the core runs from HSI (8 MHz) out of reset  */
+    SystemClock_Config();
+#endif /*  BENCH_QEMU  */
+
+    bench_usart_init();
+    bench_cycles_init();
+    bench_calibrate();
+
+    bench_puts("{\r\n  \"suite\": \"simple_os_target\",\r\n  \"config\": {\"task_count\": ");
+    bench_put_u32(OS_TASK_COUNT);
+    bench_puts(", \"tick_bits\": ");
+    bench_put_u32(sizeof(OS_Tick_t) * 8u);
+#if OS_USE_BITBAND_READY
+    bench_puts(", \"ready_flags\": \"bitband\"");
+#else
+    bench_puts(", \"ready_flags\": \"counter\"");
+#endif /*  OS_USE_BITBAND_READY  */
+    bench_puts(", \"core_clock_hz\": ");
+    bench_put_u32(SystemCoreClock);
+#ifdef BENCH_QEMU
+    bench_puts(", \"cycle_source\": \"systick\"");
+#else
+    bench_puts(", \"cycle_source\": \"dwt\"");
+#endif /*  BENCH_QEMU  */
+    bench_puts(", \"cycle_overhead\": ");
+    bench_put_u32(bench_overhead);
+    bench_puts("},\r\n  \"results\": [");
+
+    bench_add_delete();
+
+    for(pattern = 0; pattern < BENCH_PATTERN_COUNT; pattern++)
+    {
+        bench_tick((Bench_Pattern_t)pattern);
+    }
+
+    bench_log();
+
+    bench_fmt();
+
+    bench_queue();
+
+    bench_seqlock();
+
+#if OS_USE_THREADS
+    bench_thread();
+#endif /*  OS_USE_THREADS  */
+
+#if !defined(BENCH_QEMU) && UART_USE_TX_DMA
+    bench_uart_tx();
+#endif /*  !BENCH_QEMU && UART_USE_TX_DMA  */
+
+    bench_puts("\r\n  ]\r\n}\r\n");
+    bench_flush();
+
+    bench_exit();
+
+    return 0;
+}
+
+void SystemClock_Config(void)
+{
+    LL_FLASH_SetLatency(LL_FLASH_LATENCY_0);
+    while(LL_FLASH_GetLatency()!= LL_FLASH_LATENCY_0)
+    {
+    }
+    LL_RCC_HSI_SetCalibTrimming(16);
+    LL_RCC_HSI_Enable();
+
+    /* Wait till HSI is ready */
+    while(LL_RCC_HSI_IsReady() != 1)
+    {
+
+    }
+    LL_RCC_SetAHBPrescaler(LL_RCC_SYSCLK_DIV_1);
+    LL_RCC_SetAPB1Prescaler(LL_RCC_APB1_DIV_1);
+    LL_RCC_SetAPB2Prescaler(LL_RCC_APB2_DIV_1);
+    LL_RCC_SetSysClkSource(LL_RCC_SYS_CLKSOURCE_HSI);
+
+    /* Wait till System clock is ready */
+    while(LL_RCC_GetSysClkSource() != LL_RCC_SYS_CLKSOURCE_STATUS_HSI)
+    {
+    }
+
+    LL_Init1msTick(8000000);
+    LL_SetSystemCoreClock(8000000);
+}
+
+void SysTick_Handler(void)
+{
+    OS_vidUpdateTasks();
+}
+
+void Error_Handler(void)
+{
+    __disable_irq();
+    while (1)
+    {
+    }
+}
+
+#ifdef  USE_FULL_ASSERT
+void assert_failed(uint8_t *file, uint32_t line)
+{
+    (void)file;
+    (void)line;
+}
+#endif /* USE_FULL_ASSERT */
@@ -23,6 +23,8 @@
 /* Private includes ----------------------------------------------------------*/
 /* USER CODE BEGIN Includes */
 #include "simple_os.h"
+#include "pc_sampler/pc_sampler.h"
+#include "irq/irq.h"
 /* USER CODE END Includes */
 
 /* Private typedef -----------------------------------------------------------*/
@@ -105,6 +107,9 @@ int main(void)
     LL_GPIO_AF_Remap_SWJ_NOJTAG();
 
     /* USER CODE BEGIN Init */
+#if IRQ_USE_RAM_VECTORS
+    IRQ_vidRelocateVectorTable();
+#endif /*  IRQ_USE_RAM_VECTORS  */
 
     /* USER CODE END Init */
 
@@ -127,6 +132,10 @@ int main(void)
 
     OS_vidInitialize();
 
+#if PCS_USE_PC_SAMPLING
+    PCS_vidInitialize();
+#endif /*  PCS_USE_PC_SAMPLING  */
+
     for(uint32_t i = 0; i < OS_TASK_COUNT; i++)
     {
         LL_GPIO_SetPinMode(
@@ -213,7 +222,13 @@ void task_fn(void * const args)
     LL_GPIO_TogglePin(Local_psArgs->gpio_port, Local_psArgs->gpio_pin);
 }
 
+#if PCS_USE_PC_SAMPLING
+PCS_SAMPLED_HANDLER(SysTick_Handler, App_vidTickHandler)
+
+void App_vidTickHandler(void)
+#else
 void SysTick_Handler(void)
+#endif /*  PCS_USE_PC_SAMPLING  */
 {
     OS_vidUpdateTasks();
 }
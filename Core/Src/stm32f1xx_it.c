@@ -22,6 +22,9 @@
 #include "stm32f1xx_it.h"
 /* Private includes ----------------------------------------------------------*/
 /* USER CODE BEGIN Includes */
+#include "uart/uart_tx.h"
+#include "uart/uart_rx.h"
+#include "simple_os_conf.h"
 /* USER CODE END Includes */
 
 /* Private typedef -----------------------------------------------------------*/
@@ -164,6 +167,8 @@ void DebugMon_Handler(void)
   /* USER CODE END DebugMonitor_IRQn 1 */
 }
 
+/* PendSV_Handler() is the threads' context switch when enabled (simple_os_thread.c) */
+#if !OS_USE_THREADS
 /**
   * @brief This function handles Pendable request for system service.
   */
@@ -176,6 +181,7 @@ void PendSV_Handler(void)
 
   /* USER CODE END PendSV_IRQn 1 */
 }
+#endif /*  !OS_USE_THREADS  */
 
 /******************************************************************************/
 /* STM32F1xx Peripheral Interrupt Handlers                                    */
@@ -186,4 +192,32 @@ void PendSV_Handler(void)
 
 /* USER CODE BEGIN 1 */
 
+#if UART_USE_TX_DMA
+/**
+  * @brief This function handles DMA1 channel4 global interrupt (USART1 TX).
+  */
+void DMA1_Channel4_IRQHandler(void)
+{
+  UART_vidTxDmaIrqHandler();
+}
+#endif /*  UART_USE_TX_DMA  */
+
+#if UART_USE_RX_DMA
+/**
+  * @brief This function handles DMA1 channel5 global interrupt (USART1 RX).
+  */
+void DMA1_Channel5_IRQHandler(void)
+{
+  UART_vidRxDmaIrqHandler();
+}
+
+/**
+  * @brief This function handles USART1 global interrupt (RX idle line).
+  */
+void USART1_IRQHandler(void)
+{
+  UART_vidRxUsartIrqHandler();
+}
+#endif /*  UART_USE_RX_DMA  */
+
 /* USER CODE END 1 */
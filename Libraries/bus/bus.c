@@ -0,0 +1,228 @@
+/*******************************************************************************
+ * @file    bus.c
+ * @brief   Zero-copy publish/subscribe bus
+ * @details Topic buffers and reference counts, see bus.h
+ *
+ *          A buffer's reference count is the number of subscribers that may still
+ *          read it: the subscribers that received it and didn't release it yet, and
+ *          if it's the latest message, the subscribers that didn't receive it yet
+ *          (the topic's unread mask). Publishing a new message drops the previous
+ *          one's unread references.
+ * @date    18 Oct. 2026
+ * @author  Mohammad Mohsen
+ ******************************************************************************/
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "main.h"
+
+#include "utils/utils.h"
+
+#include "simple_os.h"
+#include "simple_os_port.h"
+#include "bus/bus.h"
+
+/* ------------------------------------------------------------------------- */
+
+/**
+ * @brief Reference count of a buffer being written by a publisher
+ * */
+#define BUS_REF_WRITING             0xFFu
+
+/* ------------------------------------------------------------------------- */
+
+/**
+ * @brief Topic definition & state
+ * */
+typedef struct bus_topic_def_t {
+    uint32_t * const    pu32Buffers;        /**<  Message buffers  */
+    uint8_t * const     pu8RefCount;        /**<  Buffers reference counts  */
+    const uint32_t      u32BufferWords;     /**<  Buffer size in 32-bit words  */
+    const uint32_t      u32BufferCount;     /**<  Number of buffers  */
+    const uint32_t      u32Subscribers;     /**<  Subscriber tasks priorities mask  */
+    const uint32_t      u32SubscriberCount; /**<  Number of subscribers  */
+    uint32_t            u32Unread;          /**<  Subscribers that didn't receive the latest message  */
+    uint32_t            u32Latest;          /**<  Latest message buffer index + 1, 0 if none  */
+} BUS_TopicDef_t;
+
+/* ------------------------------------------------------------------------- */
+
+/**
+ * Topics buffers, reference counts & definitions
+ * */
+#define BUS_TOPIC(xId, xSize, xBuffers, xSubscribers) \
+    typedef char xId##_needs_subscribers_plus_2_buffers \
+        [((xBuffers) >= ((uint32_t)__builtin_popcount(xSubscribers) + 2u)) ? 1 : -1]; \
+    static uint32_t xId##_au32Buffers [(((xSize) + 3u) / 4u) * (xBuffers)]; \
+    static uint8_t xId##_au8RefCount [xBuffers]; \
+    static BUS_TopicDef_t xId##_sTopic = { \
+        .pu32Buffers        = xId##_au32Buffers, \
+        .pu8RefCount        = xId##_au8RefCount, \
+        .u32BufferWords     = ((xSize) + 3u) / 4u, \
+        .u32BufferCount     = (xBuffers), \
+        .u32Subscribers     = (xSubscribers), \
+        .u32SubscriberCount = (uint32_t)__builtin_popcount(xSubscribers), \
+    };
+#include "bus/bus_topics.def"
+#undef BUS_TOPIC
+
+/**
+ * Topics, by #BUS_Topic_t
+ * */
+static BUS_TopicDef_t * const BUS_apsTopics [BUS_TOPIC_COUNT + 1u] = {
+#define BUS_TOPIC(xId, xSize, xBuffers, xSubscribers)     [xId] = &xId##_sTopic,
+#include "bus/bus_topics.def"
+#undef BUS_TOPIC
+        [BUS_TOPIC_COUNT] = NULL,
+};
+
+/* ------------------------------------------------------------------------- */
+
+/**
+ * @brief Get the index of a topic's buffer, or the number of buffers if it is not a buffer of the topic
+ * */
+static uint32_t BUS_u32BufferIndex(const BUS_TopicDef_t * psTopic, const void * pvBuffer)
+{
+    uintptr_t Local_uxOffset = (uintptr_t)pvBuffer - (uintptr_t)psTopic->pu32Buffers;
+    uint32_t Local_u32BufferSize = psTopic->u32BufferWords * sizeof(uint32_t);
+
+    if((Local_uxOffset >= ((uintptr_t)Local_u32BufferSize * psTopic->u32BufferCount)) ||
+       (((uint32_t)Local_uxOffset % Local_u32BufferSize) != 0u))
+    {
+        return psTopic->u32BufferCount;
+    }
+
+    return (uint32_t)Local_uxOffset / Local_u32BufferSize;
+}
+
+/* ------------------------------------------------------------------------- */
+
+void * BUS_pvAcquire(BUS_Topic_t enTopic)
+{
+    BUS_TopicDef_t * Local_psTopic = BUS_apsTopics[MIN((uint32_t)enTopic, (uint32_t)BUS_TOPIC_COUNT)];
+    void * Local_pvBuffer = NULL;
+    uint32_t Local_u32Idx;
+
+    if(IS_NULLPTR(Local_psTopic))
+    {
+        return NULL;
+    }
+
+    OS_PORT_ENTER_CRITICAL();
+
+    for(Local_u32Idx = 0; Local_u32Idx < Local_psTopic->u32BufferCount; Local_u32Idx++)
+    {
+        if(IS_ZERO(Local_psTopic->pu8RefCount[Local_u32Idx]))
+        {
+            Local_psTopic->pu8RefCount[Local_u32Idx] = BUS_REF_WRITING;
+            Local_pvBuffer = &Local_psTopic->pu32Buffers[Local_u32Idx * Local_psTopic->u32BufferWords];
+            break;
+        }
+    }
+
+    OS_PORT_EXIT_CRITICAL();
+
+    return Local_pvBuffer;
+}
+
+/* ------------------------------------------------------------------------- */
+
+uint32_t BUS_u32Publish(BUS_Topic_t enTopic, void * pvMessage)
+{
+    BUS_TopicDef_t * Local_psTopic = BUS_apsTopics[MIN((uint32_t)enTopic, (uint32_t)BUS_TOPIC_COUNT)];
+    uint32_t Local_u32Idx;
+
+    if(IS_NULLPTR(Local_psTopic))
+    {
+        return FALSE;
+    }
+
+    Local_u32Idx = BUS_u32BufferIndex(Local_psTopic, pvMessage);
+
+    if((Local_u32Idx >= Local_psTopic->u32BufferCount) || (Local_psTopic->pu8RefCount[Local_u32Idx] != BUS_REF_WRITING))
+    {
+        return FALSE;
+    }
+
+    OS_PORT_ENTER_CRITICAL();
+
+    /*  subscribers that didn't receive the previous message won't  */
+    if(Local_psTopic->u32Latest)
+    {
+        Local_psTopic->pu8RefCount[Local_psTopic->u32Latest - 1u] -= (uint8_t)__builtin_popcount(Local_psTopic->u32Unread);
+    }
+
+    Local_psTopic->pu8RefCount[Local_u32Idx]    = (uint8_t)Local_psTopic->u32SubscriberCount;
+    Local_psTopic->u32Unread                    = Local_psTopic->u32Subscribers;
+    Local_psTopic->u32Latest                    = Local_u32Idx + 1u;
+
+    OS_PORT_EXIT_CRITICAL();
+
+    if(Local_psTopic->u32Subscribers)
+    {
+        (void)OS_enReadyTasks(Local_psTopic->u32Subscribers);
+    }
+
+    return TRUE;
+}
+
+/* ------------------------------------------------------------------------- */
+
+const void * BUS_pvReceive(BUS_Topic_t enTopic, uint32_t u32Subscriber)
+{
+    BUS_TopicDef_t * Local_psTopic = BUS_apsTopics[MIN((uint32_t)enTopic, (uint32_t)BUS_TOPIC_COUNT)];
+    const void * Local_pvMessage = NULL;
+    uint32_t Local_u32Mask;
+
+    if(IS_NULLPTR(Local_psTopic) || (u32Subscriber >= 32u))
+    {
+        return NULL;
+    }
+
+    Local_u32Mask = BUS_SUBSCRIBER(u32Subscriber);
+
+    OS_PORT_ENTER_CRITICAL();
+
+    /*  the reference held as an unread subscriber is kept until released  */
+    if(Local_psTopic->u32Unread & Local_u32Mask)
+    {
+        Local_psTopic->u32Unread &= ~Local_u32Mask;
+        Local_pvMessage = &Local_psTopic->pu32Buffers[(Local_psTopic->u32Latest - 1u) * Local_psTopic->u32BufferWords];
+    }
+
+    OS_PORT_EXIT_CRITICAL();
+
+    return Local_pvMessage;
+}
+
+/* ------------------------------------------------------------------------- */
+
+void BUS_vidRelease(BUS_Topic_t enTopic, const void * pvMessage)
+{
+    BUS_TopicDef_t * Local_psTopic = BUS_apsTopics[MIN((uint32_t)enTopic, (uint32_t)BUS_TOPIC_COUNT)];
+    uint32_t Local_u32Idx;
+
+    if(IS_NULLPTR(Local_psTopic))
+    {
+        return;
+    }
+
+    Local_u32Idx = BUS_u32BufferIndex(Local_psTopic, pvMessage);
+
+    if(Local_u32Idx >= Local_psTopic->u32BufferCount)
+    {
+        return;
+    }
+
+    OS_PORT_ENTER_CRITICAL();
+
+    if(Local_psTopic->pu8RefCount[Local_u32Idx] && (Local_psTopic->pu8RefCount[Local_u32Idx] != BUS_REF_WRITING))
+    {
+        Local_psTopic->pu8RefCount[Local_u32Idx]--;
+    }
+
+    OS_PORT_EXIT_CRITICAL();
+}
+
+/* ------------------------------------------------------------------------- */
@@ -0,0 +1,114 @@
+/*******************************************************************************
+ * @file    bus.h
+ * @brief   Zero-copy publish/subscribe bus
+ * @details Topics pass messages from publishers to subscriber tasks without
+ *          copying them: a publisher writes a message into one of the topic's
+ *          buffers, and each subscriber task gets a pointer to that buffer.
+ *
+ *          Topics and their subscribers are listed at compile time in bus_topics.def,
+ *          subscribers are the tasks' priorities. Publishing a message stores its
+ *          reference count (the number of subscribers, a constant) and the topic's
+ *          unread subscribers mask, then releases all the subscriber tasks at once
+ *          (OS_enReadyTasks()). Subscribers are usually event tasks:
+ *
+ *          @code
+ *          // publisher (task or interrupt)
+ *          Sample_t * sample = BUS_pvAcquire(BUS_TOPIC_SAMPLE);
+ *          if(sample != NULL)
+ *          {
+ *              sample->value = ...;
+ *              BUS_u32Publish(BUS_TOPIC_SAMPLE, sample);
+ *          }
+ *
+ *          // subscriber, task of priority 4
+ *          const Sample_t * sample = BUS_pvReceive(BUS_TOPIC_SAMPLE, 4);
+ *          if(sample != NULL)
+ *          {
+ *              ...
+ *              BUS_vidRelease(BUS_TOPIC_SAMPLE, sample);
+ *          }
+ *          @endcode
+ *
+ *          A subscriber receives the latest message only: a message that is not
+ *          received before the next one is published is dropped for that subscriber.
+ *          A buffer is reused once every subscriber that received it released it,
+ *          so a topic needs a buffer per subscriber, one for the latest message, and one
+ *          being written: the number of subscribers + 2, checked at compile time.
+ *
+ *          Topics are changed in Simple OS critical sections (OS_PORT_ENTER_CRITICAL()),
+ *          interrupts using them must have priority #OS_MAX_SYSCALL_PRIORITY or lower.
+ * @date    18 Oct. 2026
+ * @author  Mohammad Mohsen
+ ******************************************************************************/
+
+#ifndef BUS_H_
+#define BUS_H_
+
+#include <stdint.h>
+
+/* ------------------------------------------------------------------------- */
+
+/**
+ * @addtogroup  bus Publish/subscribe bus
+ * @{
+ * */
+
+/**
+ * @brief Subscriber task of a topic, from its priority
+ * */
+#define BUS_SUBSCRIBER(u32Priority)     (1u << (u32Priority))
+
+/**
+ * @brief Bus topics, from bus_topics.def
+ * */
+typedef enum bus_topic_t {
+#define BUS_TOPIC(xId, xSize, xBuffers, xSubscribers)     xId,
+#include "bus/bus_topics.def"
+#undef BUS_TOPIC
+    BUS_TOPIC_COUNT,
+} BUS_Topic_t;
+
+/* ------------------------------------------------------------------------- */
+
+/**
+ * @brief Get a free buffer of a topic, to write a message to publish
+ *
+ * @param [in] enTopic : topic
+ *
+ * @return Message buffer (32-bit aligned), NULL if no buffer is free
+ * */
+void * BUS_pvAcquire(BUS_Topic_t enTopic);
+
+/**
+ * @brief Publish a message, and release the topic's subscriber tasks
+ *
+ * @param [in] enTopic   : topic
+ * @param [in] pvMessage : message buffer, got from BUS_pvAcquire()
+ *
+ * @return TRUE if the message was published, FALSE if it's not an acquired buffer of @p enTopic
+ * */
+uint32_t BUS_u32Publish(BUS_Topic_t enTopic, void * pvMessage);
+
+/**
+ * @brief Receive the latest message of a topic, if not received yet
+ *
+ * @param [in] enTopic       : topic
+ * @param [in] u32Subscriber : subscriber task priority
+ *
+ * @return Message, to be released by BUS_vidRelease(), NULL if there's no new message
+ * */
+const void * BUS_pvReceive(BUS_Topic_t enTopic, uint32_t u32Subscriber);
+
+/**
+ * @brief Release a received message
+ *
+ * @param [in] enTopic   : topic
+ * @param [in] pvMessage : message, got from BUS_pvReceive()
+ *
+ * @return void
+ * */
+void BUS_vidRelease(BUS_Topic_t enTopic, const void * pvMessage);
+
+/**@}*/
+
+#endif /* BUS_H_ */
@@ -0,0 +1,251 @@
+/*******************************************************************************
+ * @file    event.c
+ * @brief   Event flag groups
+ * @details Conditions evaluation & task release, see event.h
+ *
+ *          Flags, conditions and matched flags are only changed with interrupts
+ *          masked. Tasks whose condition became true are released after interrupts
+ *          are unmasked, all at once (OS_enReadyTasks()).
+ * @date    18 Oct. 2026
+ * @author  Mohammad Mohsen
+ ******************************************************************************/
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "main.h"
+
+#include "utils/utils.h"
+
+#include "simple_os.h"
+#include "simple_os_port.h"
+#include "event/event.h"
+
+/* ------------------------------------------------------------------------- */
+
+/**
+ * @brief Number of priorities tasks can register with, released through a 32-bit priorities mask
+ * */
+#define EVENT_PRIORITY_COUNT        MIN((uint32_t)OS_TASK_COUNT, 32u)
+
+/* ------------------------------------------------------------------------- */
+
+/**
+ * @brief Evaluate the registered conditions, consume the matched flags, called with interrupts masked
+ *
+ * @return Priorities mask of the tasks to release
+ * */
+static uint32_t EVENT_u32Evaluate(EVENT_Group_t * psGroup)
+{
+    uint32_t Local_u32Flags = psGroup->u32Flags;
+    uint32_t Local_u32Consumed = 0;
+    uint32_t Local_u32Ready = 0;
+    uint32_t Local_u32Matched;
+    uint32_t Local_u32Idx;
+    EVENT_Waiter_t * Local_psWaiter;
+
+    for(Local_u32Idx = 0; Local_u32Idx < EVENT_MAX_WAITERS; Local_u32Idx++)
+    {
+        Local_psWaiter = &psGroup->asWaiters[Local_u32Idx];
+
+        if(Local_psWaiter->u32All && ((Local_u32Flags & Local_psWaiter->u32All) == Local_psWaiter->u32All))
+        {
+            Local_u32Matched = Local_psWaiter->u32All | (Local_u32Flags & Local_psWaiter->u32Any);
+        }
+        else
+        {
+            /*  0 for unused waiters (both masks are 0)  */
+            Local_u32Matched = Local_u32Flags & Local_psWaiter->u32Any;
+        }
+
+        if(Local_u32Matched)
+        {
+            Local_psWaiter->u32Matched |= Local_u32Matched;
+            Local_u32Consumed |= Local_u32Matched;
+            Local_u32Ready |= 1u << Local_psWaiter->u32Priority;
+        }
+    }
+
+    psGroup->u32Flags = Local_u32Flags & ~Local_u32Consumed;
+
+    return Local_u32Ready;
+}
+
+/**
+ * @brief Update the flags registered tasks wait for, called with interrupts masked
+ * */
+static void EVENT_vidUpdateInterest(EVENT_Group_t * psGroup)
+{
+    uint32_t Local_u32Interest = 0;
+    uint32_t Local_u32Idx;
+
+    for(Local_u32Idx = 0; Local_u32Idx < EVENT_MAX_WAITERS; Local_u32Idx++)
+    {
+        Local_u32Interest |= psGroup->asWaiters[Local_u32Idx].u32All | psGroup->asWaiters[Local_u32Idx].u32Any;
+    }
+
+    psGroup->u32Interest = Local_u32Interest;
+}
+
+/**
+ * @brief Find a task's waiter, NULL if the task is not registered
+ * */
+static EVENT_Waiter_t * EVENT_psFindWaiter(EVENT_Group_t * psGroup, uint32_t u32Priority)
+{
+    uint32_t Local_u32Idx;
+
+    for(Local_u32Idx = 0; Local_u32Idx < EVENT_MAX_WAITERS; Local_u32Idx++)
+    {
+        if((psGroup->asWaiters[Local_u32Idx].u32All | psGroup->asWaiters[Local_u32Idx].u32Any) &&
+           (psGroup->asWaiters[Local_u32Idx].u32Priority == u32Priority))
+        {
+            return &psGroup->asWaiters[Local_u32Idx];
+        }
+    }
+
+    return NULL;
+}
+
+/* ------------------------------------------------------------------------- */
+
+EVENT_Error_t EVENT_enRegister(EVENT_Group_t * psGroup, uint32_t u32Priority, uint32_t u32All, uint32_t u32Any)
+{
+    EVENT_Waiter_t * Local_psWaiter;
+    uint32_t Local_u32Ready;
+    uint32_t Local_u32Idx;
+
+    if(IS_NULLPTR(psGroup))
+    {
+        return EVENT_ERROR_NULLPTR;
+    }
+
+    if((IS_ZERO(u32All) && IS_ZERO(u32Any)) || (u32Priority >= EVENT_PRIORITY_COUNT))
+    {
+        return EVENT_ERROR_INVALID_PARAM;
+    }
+
+    OS_PORT_ENTER_CRITICAL();
+
+    Local_psWaiter = EVENT_psFindWaiter(psGroup, u32Priority);
+
+    for(Local_u32Idx = 0; IS_NULLPTR(Local_psWaiter) && (Local_u32Idx < EVENT_MAX_WAITERS); Local_u32Idx++)
+    {
+        if(IS_ZERO(psGroup->asWaiters[Local_u32Idx].u32All | psGroup->asWaiters[Local_u32Idx].u32Any))
+        {
+            Local_psWaiter = &psGroup->asWaiters[Local_u32Idx];
+            Local_psWaiter->u32Matched  = 0;
+            Local_psWaiter->u32Priority = u32Priority;
+        }
+    }
+
+    if(IS_NULLPTR(Local_psWaiter))
+    {
+        OS_PORT_EXIT_CRITICAL();
+        return EVENT_ERROR_FULL;
+    }
+
+    Local_psWaiter->u32All = u32All;
+    Local_psWaiter->u32Any = u32Any;
+
+    EVENT_vidUpdateInterest(psGroup);
+
+    Local_u32Ready = EVENT_u32Evaluate(psGroup);
+
+    OS_PORT_EXIT_CRITICAL();
+
+    if(Local_u32Ready)
+    {
+        (void)OS_enReadyTasks(Local_u32Ready);
+    }
+
+    return EVENT_ERROR_NONE;
+}
+
+/* ------------------------------------------------------------------------- */
+
+void EVENT_vidUnregister(EVENT_Group_t * psGroup, uint32_t u32Priority)
+{
+    EVENT_Waiter_t * Local_psWaiter;
+
+    OS_PORT_ENTER_CRITICAL();
+
+    Local_psWaiter = EVENT_psFindWaiter(psGroup, u32Priority);
+
+    if(!IS_NULLPTR(Local_psWaiter))
+    {
+        Local_psWaiter->u32All      = 0;
+        Local_psWaiter->u32Any      = 0;
+        Local_psWaiter->u32Matched  = 0;
+
+        EVENT_vidUpdateInterest(psGroup);
+    }
+
+    OS_PORT_EXIT_CRITICAL();
+}
+
+/* ------------------------------------------------------------------------- */
+
+void EVENT_vidSet(EVENT_Group_t * psGroup, uint32_t u32Flags)
+{
+    uint32_t Local_u32Ready = 0;
+
+    OS_PORT_ENTER_CRITICAL();
+
+    psGroup->u32Flags |= u32Flags;
+
+    /*  conditions only change when a flag some task waits for is set  */
+    if(u32Flags & psGroup->u32Interest)
+    {
+        Local_u32Ready = EVENT_u32Evaluate(psGroup);
+    }
+
+    OS_PORT_EXIT_CRITICAL();
+
+    if(Local_u32Ready)
+    {
+        (void)OS_enReadyTasks(Local_u32Ready);
+    }
+}
+
+/* ------------------------------------------------------------------------- */
+
+void EVENT_vidClear(EVENT_Group_t * psGroup, uint32_t u32Flags)
+{
+
+    OS_PORT_ENTER_CRITICAL();
+
+    psGroup->u32Flags &= ~u32Flags;
+
+    OS_PORT_EXIT_CRITICAL();
+}
+
+/* ------------------------------------------------------------------------- */
+
+uint32_t EVENT_u32Get(const EVENT_Group_t * psGroup)
+{
+    return psGroup->u32Flags;
+}
+
+/* ------------------------------------------------------------------------- */
+
+uint32_t EVENT_u32Take(EVENT_Group_t * psGroup, uint32_t u32Priority)
+{
+    EVENT_Waiter_t * Local_psWaiter;
+    uint32_t Local_u32Matched = 0;
+
+    OS_PORT_ENTER_CRITICAL();
+
+    Local_psWaiter = EVENT_psFindWaiter(psGroup, u32Priority);
+
+    if(!IS_NULLPTR(Local_psWaiter))
+    {
+        Local_u32Matched = Local_psWaiter->u32Matched;
+        Local_psWaiter->u32Matched = 0;
+    }
+
+    OS_PORT_EXIT_CRITICAL();
+
+    return Local_u32Matched;
+}
+
+/* ------------------------------------------------------------------------- */
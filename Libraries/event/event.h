@@ -0,0 +1,163 @@
+/*******************************************************************************
+ * @file    event.h
+ * @brief   Event flag groups
+ * @details A group holds 32 event flags, set and cleared from tasks and
+ *          interrupts. Tasks (usually event tasks) register a condition on a group,
+ *          and are released (OS_enReadyTask()) when a set operation makes it true,
+ *          instead of polling the flags periodically:
+ *          - ALL mask: released when all of these flags are set
+ *          - ANY mask: released when any of these flags is set
+ *
+ *          e.g. DMA done AND new sample, OR timeout:
+ *
+ *          @code
+ *          #define EV_DMA_DONE     0x01u
+ *          #define EV_SAMPLE       0x02u
+ *          #define EV_TIMEOUT      0x04u
+ *
+ *          EVENT_Group_t adc_events;
+ *
+ *          EVENT_enRegister(&adc_events, 2, EV_DMA_DONE | EV_SAMPLE, EV_TIMEOUT);   // task of priority 2
+ *
+ *          EVENT_vidSet(&adc_events, EV_DMA_DONE);                                 // in interrupts
+ *
+ *          uint32_t events = EVENT_u32Take(&adc_events, 2);                         // in the task
+ *          @endcode
+ *
+ *          Flags that make a condition true are consumed: they are cleared from the
+ *          group and accumulated in the registered task's matched flags, read by
+ *          EVENT_u32Take(). All the registered conditions are evaluated before flags
+ *          are consumed, so tasks waiting for the same flags are all released.
+ *
+ *          Each condition is evaluated with two bitwise operations, and only when a set
+ *          operation sets a flag some registered task waits for.
+ *
+ *          Groups are changed in Simple OS critical sections (OS_PORT_ENTER_CRITICAL()),
+ *          interrupts using them must have priority #OS_MAX_SYSCALL_PRIORITY or lower.
+ *
+ *          Configuration (board_config.h):
+ *          - CONF_EVENT_MAX_WAITERS : maximum number of tasks registered to a group (default 4)
+ * @date    18 Oct. 2026
+ * @author  Mohammad Mohsen
+ ******************************************************************************/
+
+#ifndef EVENT_H_
+#define EVENT_H_
+
+#include <stdint.h>
+
+#include "board_config.h"
+
+/* ------------------------------------------------------------------------- */
+
+/**
+ * @addtogroup  event Event flag groups
+ * @{
+ * */
+
+#ifdef CONF_EVENT_MAX_WAITERS
+#define EVENT_MAX_WAITERS           CONF_EVENT_MAX_WAITERS
+#else
+#define EVENT_MAX_WAITERS           4u
+#endif  /*  CONF_EVENT_MAX_WAITERS  */
+
+/**
+ * @brief Event flag groups error codes
+ * */
+typedef enum event_error_t {
+    EVENT_ERROR_NONE            = 0,    /**<  No error  */
+    EVENT_ERROR_NULLPTR,                /**<  NULL pointer argument  */
+    EVENT_ERROR_INVALID_PARAM,          /**<  Both masks are 0, or invalid priority  */
+    EVENT_ERROR_FULL,                   /**<  #EVENT_MAX_WAITERS tasks are already registered to the group  */
+} EVENT_Error_t;
+
+/**
+ * @brief Task registered to a group
+ * */
+typedef struct event_waiter_t {
+    uint32_t    u32All;         /**<  Released when all of these flags are set  */
+    uint32_t    u32Any;         /**<  Released when any of these flags is set  */
+    uint32_t    u32Matched;     /**<  Flags consumed by this task, not taken yet  */
+    uint32_t    u32Priority;    /**<  Task priority  */
+} EVENT_Waiter_t;
+
+/**
+ * @brief Event flag group, zero initialized
+ * */
+typedef struct event_group_t {
+    volatile uint32_t   u32Flags;                       /**<  Event flags  */
+    uint32_t            u32Interest;                    /**<  Flags registered tasks wait for  */
+    EVENT_Waiter_t      asWaiters [EVENT_MAX_WAITERS];  /**<  Registered tasks, unused if both masks are 0  */
+} EVENT_Group_t;
+
+/* ------------------------------------------------------------------------- */
+
+/**
+ * @brief Register a task's condition on a group, or change it if the task is already registered.
+ * The condition is evaluated at once, with the flags already set.
+ *
+ * @param [in] psGroup     : group
+ * @param [in] u32Priority : task priority, released by OS_enReadyTasks(), in range `[0: MIN(OS_TASK_COUNT, 32) - 1]`
+ * @param [in] u32All      : released when all of these flags are set, 0 for none
+ * @param [in] u32Any      : released when any of these flags is set, 0 for none
+ *
+ * @return #EVENT_Error_t
+ *              EVENT_ERROR_NONE          : Task was registered
+ *              EVENT_ERROR_NULLPTR       : @p psGroup is NULL
+ *              EVENT_ERROR_INVALID_PARAM : @p u32All and @p u32Any are 0, or @p u32Priority is `>= OS_TASK_COUNT` or `>= 32`
+ *              EVENT_ERROR_FULL          : No more tasks can be registered to the group
+ * */
+EVENT_Error_t EVENT_enRegister(EVENT_Group_t * psGroup, uint32_t u32Priority, uint32_t u32All, uint32_t u32Any);
+
+/**
+ * @brief Unregister a task from a group, its matched flags are discarded
+ *
+ * @param [in] psGroup     : group
+ * @param [in] u32Priority : task priority
+ *
+ * @return void
+ * */
+void EVENT_vidUnregister(EVENT_Group_t * psGroup, uint32_t u32Priority);
+
+/**
+ * @brief Set flags, and release the tasks whose condition becomes true. Can be called from interrupts.
+ *
+ * @param [in] psGroup  : group
+ * @param [in] u32Flags : flags to set
+ *
+ * @return void
+ * */
+void EVENT_vidSet(EVENT_Group_t * psGroup, uint32_t u32Flags);
+
+/**
+ * @brief Clear flags. Can be called from interrupts.
+ *
+ * @param [in] psGroup  : group
+ * @param [in] u32Flags : flags to clear
+ *
+ * @return void
+ * */
+void EVENT_vidClear(EVENT_Group_t * psGroup, uint32_t u32Flags);
+
+/**
+ * @brief Get a group's flags (not consumed yet)
+ *
+ * @param [in] psGroup : group
+ *
+ * @return Flags
+ * */
+uint32_t EVENT_u32Get(const EVENT_Group_t * psGroup);
+
+/**
+ * @brief Take the flags consumed by a task's condition since the last call
+ *
+ * @param [in] psGroup     : group
+ * @param [in] u32Priority : task priority
+ *
+ * @return Matched flags, 0 if the condition wasn't true since the last call
+ * */
+uint32_t EVENT_u32Take(EVENT_Group_t * psGroup, uint32_t u32Priority);
+
+/**@}*/
+
+#endif /* EVENT_H_ */
@@ -0,0 +1,248 @@
+/*******************************************************************************
+ * @file    irq.c
+ * @brief   RAM vector table & interrupt handler registration
+ * @details Vector table relocation and instrumented trampoline, see irq.h
+ * @date    18 Oct. 2026
+ * @author  Mohammad Mohsen
+ ******************************************************************************/
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "utils/utils.h"
+
+#include "irq/irq.h"
+
+/* ------------------------------------------------------------------------- */
+
+/**
+ * Vector table in RAM, VTOR requires alignment to the table size (next power of 2)
+ * */
+static IRQ_vidHandler_t IRQ_apfVectors [IRQ_VECTOR_TABLE_SIZE] __attribute__((aligned(IRQ_VECTOR_TABLE_SIZE * 4u)));
+
+/**
+ * Handlers of instrumented interrupts, called by the trampoline
+ * */
+static IRQ_vidHandler_t IRQ_apfShadow [IRQ_VECTOR_COUNT];
+
+/**
+ * Interrupts' statistics, indexed by exception number
+ * */
+static volatile IRQ_Stats_t IRQ_asStats [IRQ_VECTOR_COUNT];
+
+/**
+ * Vector table was relocated to RAM
+ * */
+static uint32_t IRQ_u32Relocated;
+
+/* ------------------------------------------------------------------------- */
+
+/**
+ * @brief Get an interrupt's exception number (vector table index), 0 if out of range
+ * */
+static uint32_t IRQ_u32Exception(IRQn_Type enIrq)
+{
+    int32_t Local_s32Exception = (int32_t)enIrq + 16;
+
+    /*  exceptions 0 & 1 are the initial SP and reset vector  */
+    if((Local_s32Exception < 2) || (Local_s32Exception >= (int32_t)IRQ_VECTOR_COUNT))
+    {
+        return 0;
+    }
+
+    return (uint32_t)Local_s32Exception;
+}
+
+/**
+ * @brief Trampoline of instrumented interrupts
+ * */
+static void IRQ_vidTrampoline(void)
+{
+    uint32_t Local_u32Exception = SCB->ICSR & SCB_ICSR_VECTACTIVE_Msk;
+    volatile IRQ_Stats_t * Local_psStats = &IRQ_asStats[Local_u32Exception];
+    uint32_t Local_u32Start;
+    uint32_t Local_u32Cycles;
+
+    Local_u32Start = DWT->CYCCNT;
+    IRQ_apfShadow[Local_u32Exception]();
+    Local_u32Cycles = DWT->CYCCNT - Local_u32Start;
+
+    Local_psStats->count++;
+    Local_psStats->cycles += Local_u32Cycles;
+
+    if(Local_u32Cycles > Local_psStats->cycles_max)
+    {
+        Local_psStats->cycles_max = Local_u32Cycles;
+    }
+}
+
+/* ------------------------------------------------------------------------- */
+
+void IRQ_vidRelocateVectorTable(void)
+{
+    const IRQ_vidHandler_t * Local_ppfActive = (const IRQ_vidHandler_t *)SCB->VTOR;
+    uint32_t Local_u32Primask = __get_PRIMASK();
+
+    if(IRQ_u32Relocated)
+    {
+        return;
+    }
+
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+    __disable_irq();
+
+    memcpy(IRQ_apfVectors, Local_ppfActive, IRQ_VECTOR_COUNT * sizeof(IRQ_vidHandler_t));
+
+    SCB->VTOR = (uint32_t)IRQ_apfVectors;
+    __DSB();
+    __ISB();
+
+    IRQ_u32Relocated = 1;
+
+    __set_PRIMASK(Local_u32Primask);
+}
+
+/* ------------------------------------------------------------------------- */
+
+IRQ_Error_t IRQ_enRegisterHandler(IRQn_Type enIrq, IRQ_vidHandler_t pfHandler)
+{
+    uint32_t Local_u32Exception = IRQ_u32Exception(enIrq);
+
+    if(IS_NULLPTR(pfHandler))
+    {
+        return IRQ_ERROR_NULLPTR;
+    }
+
+    if(IS_ZERO(Local_u32Exception))
+    {
+        return IRQ_ERROR_INVALID_PARAM;
+    }
+
+    if(IS_ZERO(IRQ_u32Relocated))
+    {
+        return IRQ_ERROR_NOT_RELOCATED;
+    }
+
+    /*  a single word write, the vector is always valid  */
+    if(IRQ_apfVectors[Local_u32Exception] == IRQ_vidTrampoline)
+    {
+        IRQ_apfShadow[Local_u32Exception] = pfHandler;
+    }
+    else
+    {
+        IRQ_apfVectors[Local_u32Exception] = pfHandler;
+    }
+
+    return IRQ_ERROR_NONE;
+}
+
+/* ------------------------------------------------------------------------- */
+
+IRQ_vidHandler_t IRQ_pfGetHandler(IRQn_Type enIrq)
+{
+    uint32_t Local_u32Exception = IRQ_u32Exception(enIrq);
+    const IRQ_vidHandler_t * Local_ppfVectors = (const IRQ_vidHandler_t *)SCB->VTOR;
+
+    if(IS_ZERO(Local_u32Exception))
+    {
+        return NULL;
+    }
+
+    if(Local_ppfVectors[Local_u32Exception] == IRQ_vidTrampoline)
+    {
+        return IRQ_apfShadow[Local_u32Exception];
+    }
+
+    return Local_ppfVectors[Local_u32Exception];
+}
+
+/* ------------------------------------------------------------------------- */
+
+IRQ_Error_t IRQ_enInstrument(IRQn_Type enIrq, uint32_t u32Enable)
+{
+    uint32_t Local_u32Exception = IRQ_u32Exception(enIrq);
+
+    if(IS_ZERO(Local_u32Exception))
+    {
+        return IRQ_ERROR_INVALID_PARAM;
+    }
+
+    if(IS_ZERO(IRQ_u32Relocated))
+    {
+        return IRQ_ERROR_NOT_RELOCATED;
+    }
+
+    if(u32Enable)
+    {
+        if(IRQ_apfVectors[Local_u32Exception] != IRQ_vidTrampoline)
+        {
+            /*  shadow handler must be valid before the trampoline is installed  */
+            IRQ_apfShadow[Local_u32Exception] = IRQ_apfVectors[Local_u32Exception];
+            __DMB();
+            IRQ_apfVectors[Local_u32Exception] = IRQ_vidTrampoline;
+        }
+    }
+    else
+    {
+        if(IRQ_apfVectors[Local_u32Exception] == IRQ_vidTrampoline)
+        {
+            IRQ_apfVectors[Local_u32Exception] = IRQ_apfShadow[Local_u32Exception];
+        }
+    }
+
+    __DSB();
+
+    return IRQ_ERROR_NONE;
+}
+
+/* ------------------------------------------------------------------------- */
+
+IRQ_Error_t IRQ_enGetStats(IRQn_Type enIrq, IRQ_Stats_t * psStats)
+{
+    uint32_t Local_u32Exception = IRQ_u32Exception(enIrq);
+    uint32_t Local_u32Primask;
+
+    if(IS_NULLPTR(psStats))
+    {
+        return IRQ_ERROR_NULLPTR;
+    }
+
+    if(IS_ZERO(Local_u32Exception))
+    {
+        return IRQ_ERROR_INVALID_PARAM;
+    }
+
+    /*  statistics are written from interrupt context  */
+    Local_u32Primask = __get_PRIMASK();
+    __disable_irq();
+    psStats->count      = IRQ_asStats[Local_u32Exception].count;
+    psStats->cycles     = IRQ_asStats[Local_u32Exception].cycles;
+    psStats->cycles_max = IRQ_asStats[Local_u32Exception].cycles_max;
+    __set_PRIMASK(Local_u32Primask);
+
+    return IRQ_ERROR_NONE;
+}
+
+/* ------------------------------------------------------------------------- */
+
+void IRQ_vidResetStats(void)
+{
+    uint32_t Local_u32Exception;
+    uint32_t Local_u32Primask = __get_PRIMASK();
+
+    __disable_irq();
+
+    for(Local_u32Exception = 0; Local_u32Exception < IRQ_VECTOR_COUNT; Local_u32Exception++)
+    {
+        IRQ_asStats[Local_u32Exception].count       = 0;
+        IRQ_asStats[Local_u32Exception].cycles      = 0;
+        IRQ_asStats[Local_u32Exception].cycles_max  = 0;
+    }
+
+    __set_PRIMASK(Local_u32Primask);
+}
+
+/* ------------------------------------------------------------------------- */
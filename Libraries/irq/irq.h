@@ -0,0 +1,152 @@
+/*******************************************************************************
+ * @file    irq.h
+ * @brief   RAM vector table & interrupt handler registration
+ * @details Relocates the vector table from flash (startup_stm32f103xb.s) to RAM
+ *          through SCB->VTOR, so interrupt handlers can be registered at run time.
+ *
+ *          An interrupt can also be instrumented: its handler is moved to a shadow
+ *          table and the vector points to a trampoline that counts invocations and
+ *          cycles (DWT cycle counter) spent in the handler. The trampoline finds the
+ *          active exception in SCB->ICSR (VECTACTIVE), so a single trampoline serves
+ *          all instrumented interrupts, at a cost of ~20 cycles per invocation.
+ *
+ *          Cycles of an instrumented interrupt include the cycles of higher priority
+ *          interrupts that preempt it. Handlers wrapped by PCS_SAMPLED_HANDLER()
+ *          (pc_sampler.h) read the exception frame from the stack, and must not be
+ *          instrumented.
+ *
+ *          Configuration (board_config.h):
+ *          - CONF_IRQ_USE_RAM_VECTORS : relocate the vector table at start-up (default 0)
+ * @date    18 Oct. 2026
+ * @author  Mohammad Mohsen
+ ******************************************************************************/
+
+#ifndef IRQ_H_
+#define IRQ_H_
+
+#include <stdint.h>
+
+#include "main.h"
+#include "board_config.h"
+
+/* ------------------------------------------------------------------------- */
+
+/**
+ * @addtogroup  irq Interrupt vectors
+ * @{
+ * */
+
+#ifdef CONF_IRQ_USE_RAM_VECTORS
+#define IRQ_USE_RAM_VECTORS         CONF_IRQ_USE_RAM_VECTORS
+#else
+#define IRQ_USE_RAM_VECTORS         0
+#endif  /*  CONF_IRQ_USE_RAM_VECTORS  */
+
+/**
+ * @brief Number of vectors: initial SP, 15 system exceptions & 43 STM32F103xB interrupts
+ * */
+#define IRQ_VECTOR_COUNT            (16u + (uint32_t)USBWakeUp_IRQn + 1u)
+
+/**
+ * @brief Vector table size in RAM, a power of 2 so the table can be aligned to its size (VTOR)
+ * */
+#define IRQ_VECTOR_TABLE_SIZE       64u
+
+/**
+ * @brief Interrupt handler
+ * */
+typedef void (*IRQ_vidHandler_t)(void);
+
+/**
+ * @brief Error codes
+ * */
+typedef enum irq_error_t {
+    IRQ_ERROR_NONE              = 0,    /**<  No error  */
+    IRQ_ERROR_NULLPTR,                  /**<  NULL pointer argument  */
+    IRQ_ERROR_INVALID_PARAM,            /**<  Interrupt number out of range  */
+    IRQ_ERROR_NOT_RELOCATED,            /**<  Vector table was not relocated to RAM  */
+} IRQ_Error_t;
+
+/**
+ * @brief Interrupt statistics, as returned by IRQ_enGetStats()
+ * */
+typedef struct irq_stats_t {
+    uint32_t    count;              /**<  Number of invocations  */
+    uint32_t    cycles_max;         /**<  Longest invocation (cycles)  */
+    uint64_t    cycles;             /**<  Total cycles in the handler  */
+} IRQ_Stats_t;
+
+/* ------------------------------------------------------------------------- */
+
+/**
+ * @brief Copy the active vector table to RAM and switch SCB->VTOR to it.
+ * Also enables the DWT cycle counter used by instrumented interrupts.
+ *
+ * @param void
+ *
+ * @return void
+ * */
+void IRQ_vidRelocateVectorTable(void);
+
+/**
+ * @brief Register an interrupt handler. If the interrupt is instrumented, the handler
+ * is called by the trampoline.
+ *
+ * @param [in] enIrq     : interrupt number (negative values are system exceptions, e.g. SysTick_IRQn)
+ * @param [in] pfHandler : interrupt handler
+ *
+ * @return #IRQ_Error_t
+ *              IRQ_ERROR_NONE          : Handler was registered
+ *              IRQ_ERROR_NULLPTR       : @p pfHandler is NULL
+ *              IRQ_ERROR_INVALID_PARAM : @p enIrq is out of range
+ *              IRQ_ERROR_NOT_RELOCATED : IRQ_vidRelocateVectorTable() was not called
+ * */
+IRQ_Error_t IRQ_enRegisterHandler(IRQn_Type enIrq, IRQ_vidHandler_t pfHandler);
+
+/**
+ * @brief Get an interrupt's registered handler
+ *
+ * @param [in] enIrq : interrupt number
+ *
+ * @return Handler, NULL if @p enIrq is out of range
+ * */
+IRQ_vidHandler_t IRQ_pfGetHandler(IRQn_Type enIrq);
+
+/**
+ * @brief Enable / disable instrumentation of an interrupt. Statistics are kept when disabled.
+ *
+ * @param [in] enIrq     : interrupt number
+ * @param [in] u32Enable : 0 to disable, otherwise enable
+ *
+ * @return #IRQ_Error_t
+ *              IRQ_ERROR_NONE          : Instrumentation was enabled / disabled
+ *              IRQ_ERROR_INVALID_PARAM : @p enIrq is out of range
+ *              IRQ_ERROR_NOT_RELOCATED : IRQ_vidRelocateVectorTable() was not called
+ * */
+IRQ_Error_t IRQ_enInstrument(IRQn_Type enIrq, uint32_t u32Enable);
+
+/**
+ * @brief Get an instrumented interrupt's statistics
+ *
+ * @param [in]  enIrq   : interrupt number
+ * @param [out] psStats : pointer to a statistics structure to fill
+ *
+ * @return #IRQ_Error_t
+ *              IRQ_ERROR_NONE          : Statistics were copied to @p psStats
+ *              IRQ_ERROR_NULLPTR       : @p psStats is NULL
+ *              IRQ_ERROR_INVALID_PARAM : @p enIrq is out of range
+ * */
+IRQ_Error_t IRQ_enGetStats(IRQn_Type enIrq, IRQ_Stats_t * psStats);
+
+/**
+ * @brief Reset all interrupts' statistics
+ *
+ * @param void
+ *
+ * @return void
+ * */
+void IRQ_vidResetStats(void);
+
+/**@}*/
+
+#endif /* IRQ_H_ */
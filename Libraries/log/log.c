@@ -0,0 +1,225 @@
+/*******************************************************************************
+ * @file    log.c
+ * @brief   Deferred formatting binary logger
+ * @details Lock-free ring buffer and record encoding, see log.h
+ *
+ *          The ring buffer holds records of 32-bit words: a header word, then the
+ *          record's arguments. Producers reserve words by moving the reserve index
+ *          with LDREX/STREX, write the arguments, then the header, which publishes
+ *          the record. The consumer (LOG_u32Flush()) reads records in order up to
+ *          the first unpublished header, and clears the words it read.
+ *
+ *          A record is published when its header is written, so a record
+ *          interrupted by a higher priority log call delays records reserved after
+ *          it, until it is published.
+ * @date    18 Oct. 2026
+ * @author  Mohammad Mohsen
+ ******************************************************************************/
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "main.h"
+
+#include "utils/utils.h"
+
+#include "uart/uart_tx.h"
+#include "log/log.h"
+
+#if (LOG_BUFFER_WORDS & (LOG_BUFFER_WORDS - 1))
+#error "LOG_BUFFER_WORDS must be a power of 2"
+#endif
+
+/* ------------------------------------------------------------------------- */
+
+/**
+ * @brief Header word: published flag, number of arguments and message ID
+ * */
+#define LOG_HEADER_VALID            0x80000000u
+#define LOG_HEADER_COUNT_SHIFT      24u
+#define LOG_HEADER_ID_MASK          0x00FFFFFFu
+
+/**
+ * @brief Largest encoded record: tag byte, 5 LEB128 words
+ * */
+#define LOG_RECORD_MAX_BYTES        (1u + ((LOG_MAX_ARGS + 1u) * 5u))
+
+/**
+ * @brief Transmit buffer space reserved by a flush
+ * */
+#define LOG_FLUSH_BYTES             (LOG_RECORD_MAX_BYTES * 4u)
+
+/* ------------------------------------------------------------------------- */
+
+/**
+ * Ring buffer, 0 words are free or not published yet
+ * */
+static volatile uint32_t LOG_au32Buffer [LOG_BUFFER_WORDS];
+
+/**
+ * Reserve index (free running), moved by producers
+ * */
+static volatile uint32_t LOG_u32Reserve;
+
+/**
+ * Read index (free running), moved by the consumer
+ * */
+static volatile uint32_t LOG_u32Read;
+
+/**
+ * Records dropped since the last flush
+ * */
+static volatile uint32_t LOG_u32Lost;
+
+/* ------------------------------------------------------------------------- */
+
+/**
+ * @brief Encode a value as LEB128, return the number of bytes
+ * */
+static uint32_t LOG_u32Leb128(uint8_t * pu8Buffer, uint32_t u32Value)
+{
+    uint32_t Local_u32Size = 0;
+
+    while(u32Value >= 0x80u)
+    {
+        pu8Buffer[Local_u32Size++] = (uint8_t)(u32Value | 0x80u);
+        u32Value >>= 7;
+    }
+
+    pu8Buffer[Local_u32Size++] = (uint8_t)u32Value;
+
+    return Local_u32Size;
+}
+
+/* ------------------------------------------------------------------------- */
+
+void LOG_vidWrite(uint32_t u32Id, const uint32_t * pu32Args, uint32_t u32Count)
+{
+    uint32_t Local_u32Start;
+    uint32_t Local_u32Idx;
+
+    if(u32Count > LOG_MAX_ARGS)
+    {
+        return;
+    }
+
+    do
+    {
+        Local_u32Start = __LDREXW(&LOG_u32Reserve);
+
+        if(((Local_u32Start + u32Count + 1u) - LOG_u32Read) > LOG_BUFFER_WORDS)
+        {
+            __CLREX();
+
+            do
+            {
+                Local_u32Idx = __LDREXW(&LOG_u32Lost);
+            } while(__STREXW(Local_u32Idx + 1u, &LOG_u32Lost));
+
+            return;
+        }
+    } while(__STREXW(Local_u32Start + u32Count + 1u, &LOG_u32Reserve));
+
+    for(Local_u32Idx = 0; Local_u32Idx < u32Count; Local_u32Idx++)
+    {
+        LOG_au32Buffer[(Local_u32Start + 1u + Local_u32Idx) & (LOG_BUFFER_WORDS - 1u)] = pu32Args[Local_u32Idx];
+    }
+
+    /*  publish the record after its arguments  */
+    __DMB();
+    LOG_au32Buffer[Local_u32Start & (LOG_BUFFER_WORDS - 1u)] =
+            LOG_HEADER_VALID | (u32Count << LOG_HEADER_COUNT_SHIFT) | (u32Id & LOG_HEADER_ID_MASK);
+}
+
+/* ------------------------------------------------------------------------- */
+
+uint32_t LOG_u32Flush(void)
+{
+    uint8_t * Local_pu8Buffer;
+    uint32_t Local_u32Size = 0;
+    uint32_t Local_u32Records = 0;
+    uint32_t Local_u32Read = LOG_u32Read;
+    uint32_t Local_u32Header;
+    uint32_t Local_u32Count;
+    uint32_t Local_u32Lost;
+    uint32_t Local_u32Idx;
+
+    if(IS_ZERO(LOG_au32Buffer[Local_u32Read & (LOG_BUFFER_WORDS - 1u)]) && IS_ZERO(LOG_u32Lost))
+    {
+        return 0;
+    }
+
+    Local_pu8Buffer = UART_pu8TxReserve(LOG_FLUSH_BYTES);
+
+    if(IS_NULLPTR(Local_pu8Buffer))
+    {
+        return 0;
+    }
+
+    if(LOG_u32Lost)
+    {
+        do
+        {
+            Local_u32Lost = __LDREXW(&LOG_u32Lost);
+        } while(__STREXW(0, &LOG_u32Lost));
+
+        Local_pu8Buffer[Local_u32Size++] = LOG_TAG_LOST;
+        Local_u32Size += LOG_u32Leb128(&Local_pu8Buffer[Local_u32Size], Local_u32Lost);
+    }
+
+    while((Local_u32Size + LOG_RECORD_MAX_BYTES) <= LOG_FLUSH_BYTES)
+    {
+        Local_u32Header = LOG_au32Buffer[Local_u32Read & (LOG_BUFFER_WORDS - 1u)];
+
+        if(!(Local_u32Header & LOG_HEADER_VALID))
+        {
+            break;
+        }
+
+        /*  arguments are read after the header  */
+        __DMB();
+
+        Local_u32Count = (Local_u32Header >> LOG_HEADER_COUNT_SHIFT) & 0x7Fu;
+
+        Local_pu8Buffer[Local_u32Size++] = (uint8_t)(LOG_TAG_RECORD | Local_u32Count);
+        Local_u32Size += LOG_u32Leb128(&Local_pu8Buffer[Local_u32Size], Local_u32Header & LOG_HEADER_ID_MASK);
+
+        LOG_au32Buffer[Local_u32Read & (LOG_BUFFER_WORDS - 1u)] = 0;
+
+        for(Local_u32Idx = 1; Local_u32Idx <= Local_u32Count; Local_u32Idx++)
+        {
+            Local_u32Size += LOG_u32Leb128(&Local_pu8Buffer[Local_u32Size], LOG_au32Buffer[(Local_u32Read + Local_u32Idx) & (LOG_BUFFER_WORDS - 1u)]);
+            LOG_au32Buffer[(Local_u32Read + Local_u32Idx) & (LOG_BUFFER_WORDS - 1u)] = 0;
+        }
+
+        Local_u32Read += Local_u32Count + 1u;
+        Local_u32Records++;
+    }
+
+    /*  words are cleared before they are released to producers  */
+    __DMB();
+    LOG_u32Read = Local_u32Read;
+
+    UART_vidTxCommit(Local_u32Size);
+
+    return Local_u32Records;
+}
+
+/* ------------------------------------------------------------------------- */
+
+void LOG_vidReset(void)
+{
+    uint32_t Local_u32Idx;
+
+    for(Local_u32Idx = 0; Local_u32Idx < LOG_BUFFER_WORDS; Local_u32Idx++)
+    {
+        LOG_au32Buffer[Local_u32Idx] = 0;
+    }
+
+    LOG_u32Read     = 0;
+    LOG_u32Reserve  = 0;
+    LOG_u32Lost     = 0;
+}
+
+/* ------------------------------------------------------------------------- */
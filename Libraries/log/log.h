@@ -0,0 +1,196 @@
+/*******************************************************************************
+ * @file    log.h
+ * @brief   Deferred formatting binary logger
+ * @details Log calls don't format anything on the target. The format string of
+ *          each call site is placed in the `.log_strings` section, which is kept
+ *          in the ELF file but not loaded to the target (see STM32F103CBTx_FLASH.ld),
+ *          and its address in that section is the message ID.
+ *
+ *          A log call only writes the message ID and its raw 32-bit arguments
+ *          to a lock-free ring buffer (LDREX/STREX reservation), so it can be
+ *          called from tasks and interrupts:
+ *
+ *          @code
+ *          LOG_INFO("task %u took %u cycles", priority, cycles);
+ *          LOG_WARN("temperature %f", LOG_u32Float(temperature));
+ *          @endcode
+ *
+ *          LOG_u32Flush() is called periodically from a task, it encodes pending
+ *          records to the USART1 transmit channel (uart_tx.h). Records are encoded as:
+ *          - tag byte: 0xA0 | number of arguments (0 to 4)
+ *          - message ID, LEB128
+ *          - arguments, LEB128 each
+ *
+ *          Records lost because the ring buffer was full are reported by a
+ *          0xAF tag byte, followed by the number of lost records (LEB128).
+ *
+ *          Tools/log_decode.py extracts the format strings from the ELF file,
+ *          and formats the records on the host.
+ *
+ *          Arguments are integers or pointers (at most 4), floats are passed through
+ *          LOG_u32Float(). Strings (`%s`) are not supported.
+ *
+ *          Configuration (board_config.h):
+ *          - CONF_LOG_LEVEL : lowest compiled level, LOG_LEVEL_xxx (default LOG_LEVEL_INFO)
+ *          - CONF_LOG_BUFFER_WORDS : ring buffer size in 32-bit words, power of 2 (default 128)
+ * @date    18 Oct. 2026
+ * @author  Mohammad Mohsen
+ ******************************************************************************/
+
+#ifndef LOG_H_
+#define LOG_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "board_config.h"
+
+/* ------------------------------------------------------------------------- */
+
+/**
+ * @addtogroup  log Binary logger
+ * @{
+ * */
+
+/**
+ * @brief Log levels
+ * */
+#define LOG_LEVEL_NONE              0u
+#define LOG_LEVEL_ERROR             1u
+#define LOG_LEVEL_WARN              2u
+#define LOG_LEVEL_INFO              3u
+#define LOG_LEVEL_DEBUG             4u
+
+#ifdef CONF_LOG_LEVEL
+#define LOG_LEVEL                   CONF_LOG_LEVEL
+#else
+#define LOG_LEVEL                   LOG_LEVEL_INFO
+#endif  /*  CONF_LOG_LEVEL  */
+
+#ifdef CONF_LOG_BUFFER_WORDS
+#define LOG_BUFFER_WORDS            CONF_LOG_BUFFER_WORDS
+#else
+#define LOG_BUFFER_WORDS            128u
+#endif  /*  CONF_LOG_BUFFER_WORDS  */
+
+/**
+ * @brief Maximum number of arguments of a log call
+ * */
+#define LOG_MAX_ARGS                4u
+
+/**
+ * @brief Record tag bytes on the wire
+ * */
+#define LOG_TAG_RECORD              0xA0u   /**<  Record, OR'ed with the number of arguments  */
+#define LOG_TAG_LOST                0xAFu   /**<  Lost records  */
+
+/* ------------------------------------------------------------------------- */
+
+#define LOG_CAT_(a, b)              a ## b
+#define LOG_CAT(a, b)               LOG_CAT_(a, b)
+#define LOG_STR_(x)                 #x
+#define LOG_STR(x)                  LOG_STR_(x)
+
+/**
+ * @brief Number of arguments after the format string
+ * */
+#define LOG_NARGS_(fmt, a1, a2, a3, a4, n, ...)     n
+#define LOG_NARGS(...)              LOG_NARGS_(__VA_ARGS__, 4, 3, 2, 1, 0, ~)
+
+/**
+ * @brief Define a call site's message in the `.log_strings` section: level letter,
+ * location and format string, separated by NUL characters. Its address is the message ID.
+ * */
+#define LOG_DEFINE(tag, fmt)        static const char LOG_acString[] __attribute__((section(".log_strings"), used)) = \
+                                        tag "\0" __FILE__ ":" LOG_STR(__LINE__) "\0" fmt
+
+#define LOG_ID                      ((uint32_t)LOG_acString)
+
+#define LOG_RECORD_0(tag, fmt)                  do { LOG_DEFINE(tag, fmt); LOG_vidWrite(LOG_ID, NULL, 0u); } while(0)
+#define LOG_RECORD_1(tag, fmt, a1)              do { LOG_DEFINE(tag, fmt); LOG_vidWrite(LOG_ID, (const uint32_t []){(uint32_t)(a1)}, 1u); } while(0)
+#define LOG_RECORD_2(tag, fmt, a1, a2)          do { LOG_DEFINE(tag, fmt); LOG_vidWrite(LOG_ID, (const uint32_t []){(uint32_t)(a1), (uint32_t)(a2)}, 2u); } while(0)
+#define LOG_RECORD_3(tag, fmt, a1, a2, a3)      do { LOG_DEFINE(tag, fmt); LOG_vidWrite(LOG_ID, (const uint32_t []){(uint32_t)(a1), (uint32_t)(a2), (uint32_t)(a3)}, 3u); } while(0)
+#define LOG_RECORD_4(tag, fmt, a1, a2, a3, a4)  do { LOG_DEFINE(tag, fmt); LOG_vidWrite(LOG_ID, (const uint32_t []){(uint32_t)(a1), (uint32_t)(a2), (uint32_t)(a3), (uint32_t)(a4)}, 4u); } while(0)
+
+/**
+ * @brief Log a message with a level letter, a format string and up to 4 arguments
+ * */
+#define LOG_RECORD(tag, ...)        LOG_CAT(LOG_RECORD_, LOG_NARGS(__VA_ARGS__))(tag, __VA_ARGS__)
+
+#if (LOG_LEVEL >= LOG_LEVEL_ERROR)
+#define LOG_ERROR(...)              LOG_RECORD("E", __VA_ARGS__)
+#else
+#define LOG_ERROR(...)              do {} while(0)
+#endif
+
+#if (LOG_LEVEL >= LOG_LEVEL_WARN)
+#define LOG_WARN(...)               LOG_RECORD("W", __VA_ARGS__)
+#else
+#define LOG_WARN(...)               do {} while(0)
+#endif
+
+#if (LOG_LEVEL >= LOG_LEVEL_INFO)
+#define LOG_INFO(...)               LOG_RECORD("I", __VA_ARGS__)
+#else
+#define LOG_INFO(...)               do {} while(0)
+#endif
+
+#if (LOG_LEVEL >= LOG_LEVEL_DEBUG)
+#define LOG_DEBUG(...)              LOG_RECORD("D", __VA_ARGS__)
+#else
+#define LOG_DEBUG(...)              do {} while(0)
+#endif
+
+/* ------------------------------------------------------------------------- */
+
+/**
+ * @brief Get a float's bits, to pass it as a log argument (`%f`, `%e`, `%g`)
+ *
+ * @param [in] f32Value : value
+ *
+ * @return IEEE 754 single precision bits
+ * */
+static inline uint32_t LOG_u32Float(float f32Value)
+{
+    uint32_t Local_u32Bits;
+
+    memcpy(&Local_u32Bits, &f32Value, sizeof(Local_u32Bits));
+
+    return Local_u32Bits;
+}
+
+/**
+ * @brief Write a record to the ring buffer, called by the LOG_xxx() macros.
+ * The record is dropped (and counted) if the ring buffer is full.
+ *
+ * @param [in] u32Id    : message ID
+ * @param [in] pu32Args : arguments
+ * @param [in] u32Count : number of arguments, at most #LOG_MAX_ARGS
+ *
+ * @return void
+ * */
+void LOG_vidWrite(uint32_t u32Id, const uint32_t * pu32Args, uint32_t u32Count);
+
+/**
+ * @brief Encode pending records to the USART1 transmit channel (uart_tx.h).
+ * Must be called from a single context (a task).
+ *
+ * @param void
+ *
+ * @return Number of records sent, 0 if no record is pending or the transmit buffer is full
+ * */
+uint32_t LOG_u32Flush(void);
+
+/**
+ * @brief Discard pending records & the lost records count. Must not be called while logging.
+ *
+ * @param void
+ *
+ * @return void
+ * */
+void LOG_vidReset(void);
+
+/**@}*/
+
+#endif /* LOG_H_ */
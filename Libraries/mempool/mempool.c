@@ -0,0 +1,200 @@
+/*******************************************************************************
+ * @file    mempool.c
+ * @brief   Fixed size block memory pools
+ * @details Lock-free free list and statistics, see mempool.h
+ *
+ *          The first word of a free block holds the index + 1 of the next free block.
+ *          Popping the free list reads the head block's next index between LDREX and
+ *          STREX: an interrupt that allocates or releases blocks in between clears the
+ *          exclusive monitor (exception entry & return), so the STREX fails and the pop
+ *          is retried with the new head.
+ * @date    18 Oct. 2026
+ * @author  Mohammad Mohsen
+ ******************************************************************************/
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "main.h"
+
+#include "utils/utils.h"
+
+#include "mempool/mempool.h"
+
+/* ------------------------------------------------------------------------- */
+
+/**
+ * @brief Get a pool's block from its index
+ * */
+static inline uint32_t * MEMPOOL_pu32Block(const MEMPOOL_Pool_t * psPool, uint32_t u32Index)
+{
+    return &psPool->pu32Storage[u32Index * psPool->u32BlockWords];
+}
+
+/**
+ * @brief Get the index of a pool's block, or the number of blocks if it is not a block of the pool
+ * */
+static uint32_t MEMPOOL_u32BlockIndex(const MEMPOOL_Pool_t * psPool, const void * pvBlock)
+{
+    uintptr_t Local_uxOffset = (uintptr_t)pvBlock - (uintptr_t)psPool->pu32Storage;
+    uint32_t Local_u32BlockSize = psPool->u32BlockWords * sizeof(uint32_t);
+    uint32_t Local_u32Index;
+
+    if(Local_uxOffset >= ((uintptr_t)Local_u32BlockSize * psPool->u32BlockCount))
+    {
+        return psPool->u32BlockCount;
+    }
+
+    Local_u32Index = (uint32_t)Local_uxOffset / Local_u32BlockSize;
+
+    if(((uint32_t)Local_uxOffset - (Local_u32Index * Local_u32BlockSize)) != 0u)
+    {
+        return psPool->u32BlockCount;
+    }
+
+    return Local_u32Index;
+}
+
+/**
+ * @brief Atomically add a value to a counter, return the new value
+ * */
+static inline uint32_t MEMPOOL_u32AtomicAdd(volatile uint32_t * pu32Counter, uint32_t u32Value)
+{
+    uint32_t Local_u32Counter;
+
+    do
+    {
+        Local_u32Counter = __LDREXW(pu32Counter) + u32Value;
+    } while(__STREXW(Local_u32Counter, pu32Counter));
+
+    return Local_u32Counter;
+}
+
+/* ------------------------------------------------------------------------- */
+
+void * MEMPOOL_pvAllocate(MEMPOOL_Pool_t * psPool)
+{
+    uint32_t * Local_pu32Block = NULL;
+    uint32_t Local_u32Index;
+    uint32_t Local_u32Used;
+
+    /*  released blocks first  */
+    do
+    {
+        Local_u32Index = __LDREXW(&psPool->u32Free);
+
+        if(IS_ZERO(Local_u32Index))
+        {
+            __CLREX();
+            break;
+        }
+
+        Local_pu32Block = MEMPOOL_pu32Block(psPool, Local_u32Index - 1u);
+    } while(__STREXW(*Local_pu32Block, &psPool->u32Free));
+
+    /*  then blocks never allocated  */
+    if(IS_ZERO(Local_u32Index))
+    {
+        do
+        {
+            Local_u32Index = __LDREXW(&psPool->u32Next);
+
+            if(Local_u32Index >= psPool->u32BlockCount)
+            {
+                __CLREX();
+
+                (void)MEMPOOL_u32AtomicAdd(&psPool->u32Failed, 1u);
+
+                return NULL;
+            }
+        } while(__STREXW(Local_u32Index + 1u, &psPool->u32Next));
+
+        Local_pu32Block = MEMPOOL_pu32Block(psPool, Local_u32Index);
+    }
+
+    Local_u32Used = MEMPOOL_u32AtomicAdd(&psPool->u32Used, 1u);
+
+    /*  raise the high water mark, unless a preempting allocation raised it higher  */
+    do
+    {
+        if(Local_u32Used <= __LDREXW(&psPool->u32HighWater))
+        {
+            __CLREX();
+            break;
+        }
+    } while(__STREXW(Local_u32Used, &psPool->u32HighWater));
+
+    return Local_pu32Block;
+}
+
+/* ------------------------------------------------------------------------- */
+
+uint32_t MEMPOOL_u32Free(MEMPOOL_Pool_t * psPool, void * pvBlock)
+{
+    uint32_t Local_u32Index = MEMPOOL_u32BlockIndex(psPool, pvBlock);
+    uint32_t * Local_pu32Block = (uint32_t *)pvBlock;
+    uint32_t Local_u32Head;
+
+    if(Local_u32Index >= psPool->u32BlockCount)
+    {
+        return FALSE;
+    }
+
+    do
+    {
+        Local_u32Head = __LDREXW(&psPool->u32Free);
+        *Local_pu32Block = Local_u32Head;
+    } while(__STREXW(Local_u32Index + 1u, &psPool->u32Free));
+
+    (void)MEMPOOL_u32AtomicAdd(&psPool->u32Used, (uint32_t)-1);
+
+    return TRUE;
+}
+
+/* ------------------------------------------------------------------------- */
+
+void * MEMPOOL_pvAllocateSize(const MEMPOOL_Classes_t * psClasses, uint32_t u32Size)
+{
+    void * Local_pvBlock = NULL;
+    uint32_t Local_u32Idx;
+
+    for(Local_u32Idx = 0; (Local_u32Idx < psClasses->u32Count) && IS_NULLPTR(Local_pvBlock); Local_u32Idx++)
+    {
+        if((psClasses->ppsPools[Local_u32Idx]->u32BlockWords * sizeof(uint32_t)) >= u32Size)
+        {
+            Local_pvBlock = MEMPOOL_pvAllocate(psClasses->ppsPools[Local_u32Idx]);
+        }
+    }
+
+    return Local_pvBlock;
+}
+
+/* ------------------------------------------------------------------------- */
+
+uint32_t MEMPOOL_u32FreeBlock(const MEMPOOL_Classes_t * psClasses, void * pvBlock)
+{
+    uint32_t Local_u32Idx;
+
+    for(Local_u32Idx = 0; Local_u32Idx < psClasses->u32Count; Local_u32Idx++)
+    {
+        if(MEMPOOL_u32Free(psClasses->ppsPools[Local_u32Idx], pvBlock))
+        {
+            return TRUE;
+        }
+    }
+
+    return FALSE;
+}
+
+/* ------------------------------------------------------------------------- */
+
+void MEMPOOL_vidGetStats(const MEMPOOL_Pool_t * psPool, MEMPOOL_Stats_t * psStats)
+{
+    psStats->u32BlockSize   = psPool->u32BlockWords * sizeof(uint32_t);
+    psStats->u32BlockCount  = psPool->u32BlockCount;
+    psStats->u32Used        = psPool->u32Used;
+    psStats->u32HighWater   = psPool->u32HighWater;
+    psStats->u32Failed      = psPool->u32Failed;
+}
+
+/* ------------------------------------------------------------------------- */
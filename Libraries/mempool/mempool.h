@@ -0,0 +1,167 @@
+/*******************************************************************************
+ * @file    mempool.h
+ * @brief   Fixed size block memory pools
+ * @details Pools of fixed size blocks, defined at compile time (.bss), so
+ *          message buffers can be shared by pointer between producers and consumers
+ *          instead of being copied, with a deterministic memory footprint.
+ *
+ *          Allocation and release are O(1) and lock-free (LDREX/STREX), so they can
+ *          be called from tasks and interrupts. Free blocks are linked by index in a
+ *          free list, blocks that were never allocated are taken in order, so pools
+ *          need no initialization.
+ *
+ *          @code
+ *          MEMPOOL_DEFINE(msg_pool, 32, 8);                    // 8 blocks of 32 bytes
+ *
+ *          uint8_t * msg = MEMPOOL_pvAllocate(&msg_pool);      // NULL when exhausted
+ *          ...
+ *          MEMPOOL_u32Free(&msg_pool, msg);
+ *          @endcode
+ *
+ *          Pools of different block sizes can be grouped in size classes: an allocation
+ *          takes a block from the smallest class that fits the requested size and has a
+ *          free block, and a block is released to the pool it belongs to:
+ *
+ *          @code
+ *          MEMPOOL_DEFINE(small_pool, 16, 16);
+ *          MEMPOOL_DEFINE(large_pool, 128, 4);
+ *          MEMPOOL_CLASSES_DEFINE(buffers, &small_pool, &large_pool);  // by increasing block size
+ *
+ *          void * buffer = MEMPOOL_pvAllocateSize(&buffers, 48);      // from large_pool
+ *          MEMPOOL_u32FreeBlock(&buffers, buffer);
+ *          @endcode
+ *
+ *          Each pool counts its blocks in use, their high water mark, and failed
+ *          allocations (MEMPOOL_vidGetStats()), to size pools from measurements.
+ * @date    18 Oct. 2026
+ * @author  Mohammad Mohsen
+ ******************************************************************************/
+
+#ifndef MEMPOOL_H_
+#define MEMPOOL_H_
+
+#include <stdint.h>
+
+/* ------------------------------------------------------------------------- */
+
+/**
+ * @addtogroup  mempool Memory pools
+ * @{
+ * */
+
+/**
+ * @brief Memory pool
+ * */
+typedef struct mempool_pool_t {
+    uint32_t * const    pu32Storage;    /**<  Blocks storage  */
+    const uint32_t      u32BlockWords;  /**<  Block size in 32-bit words  */
+    const uint32_t      u32BlockCount;  /**<  Number of blocks  */
+    volatile uint32_t   u32Free;        /**<  Free list head: block index + 1, 0 when empty  */
+    volatile uint32_t   u32Next;        /**<  Index of the first block never allocated  */
+    volatile uint32_t   u32Used;        /**<  Number of blocks in use  */
+    volatile uint32_t   u32HighWater;   /**<  Highest number of blocks in use  */
+    volatile uint32_t   u32Failed;      /**<  Number of failed allocations  */
+} MEMPOOL_Pool_t;
+
+/**
+ * @brief Size classes: pools by increasing block size
+ * */
+typedef struct mempool_classes_t {
+    MEMPOOL_Pool_t * const * ppsPools;  /**<  Pools  */
+    uint32_t                u32Count;   /**<  Number of pools  */
+} MEMPOOL_Classes_t;
+
+/**
+ * @brief Memory pool statistics
+ * */
+typedef struct mempool_stats_t {
+    uint32_t    u32BlockSize;   /**<  Block size in bytes  */
+    uint32_t    u32BlockCount;  /**<  Number of blocks  */
+    uint32_t    u32Used;        /**<  Number of blocks in use  */
+    uint32_t    u32HighWater;   /**<  Highest number of blocks in use  */
+    uint32_t    u32Failed;      /**<  Number of failed allocations  */
+} MEMPOOL_Stats_t;
+
+/**
+ * @brief Define a memory pool
+ *
+ * @param [in] xName    : pool name
+ * @param [in] u32Size  : block size in bytes, rounded up to a multiple of 4
+ * @param [in] u32Count : number of blocks
+ * */
+#define MEMPOOL_DEFINE(xName, u32Size, u32Count) \
+    static uint32_t xName##_au32Storage [(((u32Size) + 3u) / 4u) * (u32Count)]; \
+    MEMPOOL_Pool_t xName = { \
+        .pu32Storage    = xName##_au32Storage, \
+        .u32BlockWords  = ((u32Size) + 3u) / 4u, \
+        .u32BlockCount  = (u32Count), \
+    }
+
+/**
+ * @brief Define size classes
+ *
+ * @param [in] xName : size classes name
+ * @param [in] ...   : pools addresses, by increasing block size
+ * */
+#define MEMPOOL_CLASSES_DEFINE(xName, ...) \
+    static MEMPOOL_Pool_t * const xName##_apsPools [] = { __VA_ARGS__ }; \
+    const MEMPOOL_Classes_t xName = { \
+        .ppsPools   = xName##_apsPools, \
+        .u32Count   = sizeof(xName##_apsPools) / sizeof(xName##_apsPools[0]), \
+    }
+
+/* ------------------------------------------------------------------------- */
+
+/**
+ * @brief Allocate a block
+ *
+ * @param [in] psPool : pool
+ *
+ * @return Block (32-bit aligned), NULL if the pool is exhausted
+ * */
+void * MEMPOOL_pvAllocate(MEMPOOL_Pool_t * psPool);
+
+/**
+ * @brief Release a block
+ *
+ * @param [in] psPool  : pool
+ * @param [in] pvBlock : block, allocated from @p psPool
+ *
+ * @return TRUE if the block was released, FALSE if it is not a block of @p psPool
+ * */
+uint32_t MEMPOOL_u32Free(MEMPOOL_Pool_t * psPool, void * pvBlock);
+
+/**
+ * @brief Allocate a block of at least a given size, from the smallest size class
+ * that has a free block
+ *
+ * @param [in] psClasses : size classes
+ * @param [in] u32Size   : size in bytes
+ *
+ * @return Block (32-bit aligned), NULL if no size class can allocate it
+ * */
+void * MEMPOOL_pvAllocateSize(const MEMPOOL_Classes_t * psClasses, uint32_t u32Size);
+
+/**
+ * @brief Release a block to the size class it belongs to
+ *
+ * @param [in] psClasses : size classes
+ * @param [in] pvBlock   : block, allocated from @p psClasses
+ *
+ * @return TRUE if the block was released, FALSE if it is not a block of @p psClasses
+ * */
+uint32_t MEMPOOL_u32FreeBlock(const MEMPOOL_Classes_t * psClasses, void * pvBlock);
+
+/**
+ * @brief Get a pool's statistics
+ *
+ * @param [in]  psPool  : pool
+ * @param [out] psStats : statistics
+ *
+ * @return void
+ * */
+void MEMPOOL_vidGetStats(const MEMPOOL_Pool_t * psPool, MEMPOOL_Stats_t * psStats);
+
+/**@}*/
+
+#endif /* MEMPOOL_H_ */
@@ -0,0 +1,98 @@
+/*******************************************************************************
+ * @file    pc_sampler.c
+ * @brief   Statistical PC sampling profiler
+ * @details Histogram update, see pc_sampler.h
+ * @date    18 Oct. 2026
+ * @author  Mohammad Mohsen
+ ******************************************************************************/
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "utils/utils.h"
+
+#include "pc_sampler/pc_sampler.h"
+
+#if PCS_USE_PC_SAMPLING
+
+/* ------------------------------------------------------------------------- */
+
+/**
+ * Sampler state
+ * */
+volatile PCS_State_t PCS_sState;
+
+/* ------------------------------------------------------------------------- */
+
+void PCS_vidInitialize(void)
+{
+    uint32_t Local_u32Idx;
+
+    PCS_sState.enabled = 0;
+
+    for(Local_u32Idx = 0; Local_u32Idx < PCS_BUCKET_COUNT; Local_u32Idx++)
+    {
+        PCS_sState.buckets[Local_u32Idx] = 0;
+    }
+
+    PCS_sState.magic        = PCS_MAGIC;
+    PCS_sState.base         = PCS_CODE_BASE;
+    PCS_sState.bucket_shift = PCS_BUCKET_SHIFT;
+    PCS_sState.bucket_count = PCS_BUCKET_COUNT;
+    PCS_sState.samples      = 0;
+    PCS_sState.outside      = 0;
+    PCS_sState.saturated    = 0;
+    PCS_sState.divider      = 0;
+    PCS_sState.enabled      = 1;
+}
+
+/* ------------------------------------------------------------------------- */
+
+void PCS_vidEnable(uint32_t u32Enable)
+{
+    PCS_sState.enabled = !IS_ZERO(u32Enable);
+}
+
+/* ------------------------------------------------------------------------- */
+
+void PCS_vidSample(const uint32_t * pu32Frame)
+{
+    uint32_t Local_u32Offset;
+    uint32_t Local_u32Bucket;
+
+    if(IS_ZERO(PCS_sState.enabled))
+    {
+        return;
+    }
+
+    if(++PCS_sState.divider < PCS_SAMPLE_DIVIDER)
+    {
+        return;
+    }
+
+    PCS_sState.divider = 0;
+    PCS_sState.samples++;
+
+    /*  unsigned offset: addresses below the base wrap around and fall outside  */
+    Local_u32Offset = pu32Frame[PCS_FRAME_PC] - PCS_CODE_BASE;
+
+    if(Local_u32Offset >= PCS_CODE_SIZE)
+    {
+        PCS_sState.outside++;
+        return;
+    }
+
+    Local_u32Bucket = Local_u32Offset >> PCS_BUCKET_SHIFT;
+
+    if(PCS_sState.buckets[Local_u32Bucket] == UINT16_MAX)
+    {
+        PCS_sState.saturated++;
+        return;
+    }
+
+    PCS_sState.buckets[Local_u32Bucket]++;
+}
+
+/* ------------------------------------------------------------------------- */
+
+#endif /*  PCS_USE_PC_SAMPLING  */
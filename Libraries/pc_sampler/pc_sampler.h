@@ -0,0 +1,190 @@
+/*******************************************************************************
+ * @file    pc_sampler.h
+ * @brief   Statistical PC sampling profiler
+ * @details Samples the program counter of the context interrupted by a periodic
+ *          interrupt (the OS tick), and bins it into a histogram of code address
+ *          buckets of 2 ^ #PCS_BUCKET_SHIFT bytes, covering #PCS_CODE_SIZE bytes
+ *          of flash starting at #PCS_CODE_BASE.
+ *
+ *          The interrupt handler is wrapped by #PCS_SAMPLED_HANDLER(), which reads
+ *          the exception stack frame (from MSP or PSP, depending on EXC_RETURN) and
+ *          passes it to PCS_vidSample() before tail-calling the real handler:
+ *
+ *          @code
+ *          PCS_SAMPLED_HANDLER(SysTick_Handler, App_vidTickHandler)
+ *
+ *          void App_vidTickHandler(void)
+ *          {
+ *              OS_vidUpdateTasks();
+ *          }
+ *          @endcode
+ *
+ *          The histogram (PCS_sState) is dumped using a debugger, and symbolized
+ *          against the firmware's ELF or map file using Tools/pc_profile.py.
+ *
+ *          Configuration (board_config.h):
+ *          - CONF_PCS_USE_PC_SAMPLING  : enable sampling (default 0), when disabled the state
+ *                                        is not allocated and the functions are no-ops
+ *          - CONF_PCS_SAMPLE_DIVIDER   : sample every Nth interrupt (default 1)
+ *          - CONF_PCS_BUCKET_SHIFT     : log2 of bucket size in bytes (default 7, 128 bytes)
+ *          - CONF_PCS_CODE_SIZE        : sampled code size in bytes (default 128K)
+ * @date    18 Oct. 2026
+ * @author  Mohammad Mohsen
+ ******************************************************************************/
+
+#ifndef PC_SAMPLER_H_
+#define PC_SAMPLER_H_
+
+#include <stdint.h>
+
+#include "board_config.h"
+
+/* ------------------------------------------------------------------------- */
+
+/**
+ * @addtogroup  pc_sampler PC sampling profiler
+ * @{
+ * */
+
+#ifdef CONF_PCS_USE_PC_SAMPLING
+#define PCS_USE_PC_SAMPLING         CONF_PCS_USE_PC_SAMPLING
+#else
+#define PCS_USE_PC_SAMPLING         0
+#endif  /*  CONF_PCS_USE_PC_SAMPLING  */
+
+#ifdef CONF_PCS_SAMPLE_DIVIDER
+#define PCS_SAMPLE_DIVIDER          CONF_PCS_SAMPLE_DIVIDER
+#else
+#define PCS_SAMPLE_DIVIDER          1u
+#endif  /*  CONF_PCS_SAMPLE_DIVIDER  */
+
+#ifdef CONF_PCS_BUCKET_SHIFT
+#define PCS_BUCKET_SHIFT            CONF_PCS_BUCKET_SHIFT
+#else
+#define PCS_BUCKET_SHIFT            7u
+#endif  /*  CONF_PCS_BUCKET_SHIFT  */
+
+#ifdef CONF_PCS_CODE_SIZE
+#define PCS_CODE_SIZE               CONF_PCS_CODE_SIZE
+#else
+#define PCS_CODE_SIZE               0x20000u
+#endif  /*  CONF_PCS_CODE_SIZE  */
+
+/**
+ * @brief Start address of the sampled code (flash)
+ * */
+#define PCS_CODE_BASE               0x08000000u
+
+/**
+ * @brief Number of histogram buckets
+ * */
+#define PCS_BUCKET_COUNT            (PCS_CODE_SIZE >> PCS_BUCKET_SHIFT)
+
+/**
+ * @brief Index of the stacked PC in the exception stack frame (r0-r3, r12, lr, pc, xpsr)
+ * */
+#define PCS_FRAME_PC                6u
+
+/**
+ * @brief Sampler state. Kept as a single structure so it can be dumped
+ * with one debugger command.
+ * */
+typedef struct pcs_state_t {
+    uint32_t    magic;                          /**<  #PCS_MAGIC, identifies the dump  */
+    uint32_t    base;                           /**<  #PCS_CODE_BASE  */
+    uint32_t    bucket_shift;                   /**<  #PCS_BUCKET_SHIFT  */
+    uint32_t    bucket_count;                   /**<  #PCS_BUCKET_COUNT  */
+    uint32_t    samples;                        /**<  Number of samples  */
+    uint32_t    outside;                        /**<  Samples outside the sampled code range (RAM code, ROM)  */
+    uint32_t    saturated;                      /**<  Samples dropped because their bucket is full  */
+    uint32_t    divider;                        /**<  Interrupts since the last sample  */
+    uint32_t    enabled;                        /**<  Sampling is enabled  */
+    uint16_t    buckets [PCS_BUCKET_COUNT];     /**<  Histogram  */
+} PCS_State_t;
+
+/**
+ * @brief Dump identifier ("PCS1")
+ * */
+#define PCS_MAGIC                   0x31534350u
+
+/* ------------------------------------------------------------------------- */
+
+#if PCS_USE_PC_SAMPLING
+
+/**
+ * @brief Wrap an interrupt handler with PC sampling.
+ * Defines @p handler as a naked trampoline that calls PCS_vidSample() with the
+ * exception stack frame, then branches to @p target (which returns from the exception).
+ *
+ * @param [in] handler : interrupt handler name (vector table entry), e.g. SysTick_Handler
+ * @param [in] target  : C handler to call after sampling
+ * */
+#define PCS_SAMPLED_HANDLER(handler, target)                                    \
+    void target(void);                                                          \
+    __attribute__((naked)) void handler(void)                                   \
+    {                                                                           \
+        __asm volatile(                                                         \
+            "tst    lr, #4              \n"                                     \
+            "ite    eq                  \n"                                     \
+            "mrseq  r0, msp             \n"                                     \
+            "mrsne  r0, psp             \n"                                     \
+            "push   {r4, lr}            \n"                                     \
+            "bl     PCS_vidSample       \n"                                     \
+            "pop    {r4, lr}            \n"                                     \
+            "b      " #target "         \n"                                     \
+        );                                                                      \
+    }
+
+/* ------------------------------------------------------------------------- */
+
+/**
+ * Sampler state
+ * */
+extern volatile PCS_State_t PCS_sState;
+
+/**
+ * @brief Reset the histogram and enable sampling
+ *
+ * @param void
+ *
+ * @return void
+ * */
+void PCS_vidInitialize(void);
+
+/**
+ * @brief Enable / disable sampling, the histogram is kept
+ *
+ * @param [in] u32Enable : 0 to disable sampling, otherwise enable
+ *
+ * @return void
+ * */
+void PCS_vidEnable(uint32_t u32Enable);
+
+/**
+ * @brief Sample the interrupted PC (called by #PCS_SAMPLED_HANDLER() trampolines)
+ *
+ * @param [in] pu32Frame : exception stack frame of the interrupted context
+ *
+ * @return void
+ * */
+void PCS_vidSample(const uint32_t * pu32Frame);
+
+#else
+
+/*  sampling disabled: no state, handlers branch straight to their target  */
+#define PCS_SAMPLED_HANDLER(handler, target)                                    \
+    void target(void);                                                          \
+    __attribute__((naked)) void handler(void)                                   \
+    {                                                                           \
+        __asm volatile("b      " #target "         \n");                       \
+    }
+
+#define PCS_vidInitialize()                 do {} while(0)
+
+#define PCS_vidEnable(u32Enable)            do { (void)(u32Enable); } while(0)
+
+#endif /*  PCS_USE_PC_SAMPLING  */
+
+/**@}*/
+
+#endif /* PC_SAMPLER_H_ */
@@ -0,0 +1,196 @@
+/*******************************************************************************
+ * @file    queue.c
+ * @brief   Lock-free ring buffer queues
+ * @details SPSC & MPSC queues, see queue.h
+ *
+ *          SPSC: the producer writes the item, then moves the write index, the
+ *          consumer reads the item, then moves the read index. Each index has a
+ *          single writer, so no read-modify-write is shared.
+ *
+ *          MPSC: producers reserve slots with LDREX/STREX on the reserve index,
+ *          and publish a slot by writing its sequence (reserve index + 1) once the
+ *          item is written. The consumer reads the slot at the read index when its
+ *          sequence is published. Sequences are distinct for each pass over the
+ *          ring buffer, so the zero initialized sequences never match.
+ * @date    18 Oct. 2026
+ * @author  Mohammad Mohsen
+ ******************************************************************************/
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "main.h"
+
+#include "utils/utils.h"
+
+#include "simple_os.h"
+#include "queue/queue.h"
+
+/* ------------------------------------------------------------------------- */
+
+/**
+ * @brief Release the consumer task, if any. OS_enReadyTask() masks interrupts up to
+ * #OS_MAX_SYSCALL_PRIORITY, the producer must not be more urgent.
+ * */
+static inline void QUEUE_vidWakeConsumer(uint32_t u32HasConsumer, OS_TaskHandle_t xConsumer)
+{
+    if(u32HasConsumer)
+    {
+        (void)OS_enReadyTask(xConsumer);
+    }
+}
+
+/* ------------------------------------------------------------------------- */
+
+uint32_t QUEUE_u32SpscPush(QUEUE_Spsc_t * psQueue, const void * pvItem)
+{
+    uint32_t Local_u32Write = psQueue->u32Write;
+
+    if((Local_u32Write - psQueue->u32Read) > psQueue->u32Mask)
+    {
+        return FALSE;
+    }
+
+    memcpy(&psQueue->pu8Buffer[(Local_u32Write & psQueue->u32Mask) * psQueue->u32ItemSize],
+           pvItem, psQueue->u32ItemSize);
+
+    /*  publish the item after it is written  */
+    __DMB();
+    psQueue->u32Write = Local_u32Write + 1u;
+
+    QUEUE_vidWakeConsumer(psQueue->u32HasConsumer, psQueue->xConsumer);
+
+    return TRUE;
+}
+
+/* ------------------------------------------------------------------------- */
+
+uint32_t QUEUE_u32SpscPop(QUEUE_Spsc_t * psQueue, void * pvItem)
+{
+    uint32_t Local_u32Read = psQueue->u32Read;
+
+    if(Local_u32Read == psQueue->u32Write)
+    {
+        return FALSE;
+    }
+
+    __DMB();
+    memcpy(pvItem, &psQueue->pu8Buffer[(Local_u32Read & psQueue->u32Mask) * psQueue->u32ItemSize],
+           psQueue->u32ItemSize);
+
+    /*  free the slot after it is read  */
+    __DMB();
+    psQueue->u32Read = Local_u32Read + 1u;
+
+    return TRUE;
+}
+
+/* ------------------------------------------------------------------------- */
+
+uint32_t QUEUE_u32SpscCount(const QUEUE_Spsc_t * psQueue)
+{
+    return psQueue->u32Write - psQueue->u32Read;
+}
+
+/* ------------------------------------------------------------------------- */
+
+void QUEUE_vidSpscSetConsumer(QUEUE_Spsc_t * psQueue, OS_TaskHandle_t xConsumer)
+{
+    psQueue->u32HasConsumer = FALSE;
+    psQueue->xConsumer = xConsumer;
+    psQueue->u32HasConsumer = TRUE;
+}
+
+void QUEUE_vidSpscClearConsumer(QUEUE_Spsc_t * psQueue)
+{
+    psQueue->u32HasConsumer = FALSE;
+}
+
+/* ------------------------------------------------------------------------- */
+
+uint32_t QUEUE_u32MpscPush(QUEUE_Mpsc_t * psQueue, const void * pvItem)
+{
+    uint32_t Local_u32Reserve;
+    uint32_t Local_u32Dropped;
+
+    do
+    {
+        Local_u32Reserve = __LDREXW(&psQueue->u32Reserve);
+
+        if((Local_u32Reserve - psQueue->u32Read) > psQueue->u32Mask)
+        {
+            __CLREX();
+
+            do
+            {
+                Local_u32Dropped = __LDREXW(&psQueue->u32Dropped);
+            } while(__STREXW(Local_u32Dropped + 1u, &psQueue->u32Dropped));
+
+            return FALSE;
+        }
+    } while(__STREXW(Local_u32Reserve + 1u, &psQueue->u32Reserve));
+
+    memcpy(&psQueue->pu8Buffer[(Local_u32Reserve & psQueue->u32Mask) * psQueue->u32ItemSize],
+           pvItem, psQueue->u32ItemSize);
+
+    /*  publish the slot after its item  */
+    __DMB();
+    psQueue->pu32Sequence[Local_u32Reserve & psQueue->u32Mask] = Local_u32Reserve + 1u;
+
+    QUEUE_vidWakeConsumer(psQueue->u32HasConsumer, psQueue->xConsumer);
+
+    return TRUE;
+}
+
+/* ------------------------------------------------------------------------- */
+
+uint32_t QUEUE_u32MpscPop(QUEUE_Mpsc_t * psQueue, void * pvItem)
+{
+    uint32_t Local_u32Read = psQueue->u32Read;
+
+    if(psQueue->pu32Sequence[Local_u32Read & psQueue->u32Mask] != (Local_u32Read + 1u))
+    {
+        return FALSE;
+    }
+
+    __DMB();
+    memcpy(pvItem, &psQueue->pu8Buffer[(Local_u32Read & psQueue->u32Mask) * psQueue->u32ItemSize],
+           psQueue->u32ItemSize);
+
+    /*  free the slot after it is read  */
+    __DMB();
+    psQueue->u32Read = Local_u32Read + 1u;
+
+    return TRUE;
+}
+
+/* ------------------------------------------------------------------------- */
+
+uint32_t QUEUE_u32MpscDropped(QUEUE_Mpsc_t * psQueue)
+{
+    uint32_t Local_u32Dropped;
+
+    do
+    {
+        Local_u32Dropped = __LDREXW(&psQueue->u32Dropped);
+    } while(__STREXW(0, &psQueue->u32Dropped));
+
+    return Local_u32Dropped;
+}
+
+/* ------------------------------------------------------------------------- */
+
+void QUEUE_vidMpscSetConsumer(QUEUE_Mpsc_t * psQueue, OS_TaskHandle_t xConsumer)
+{
+    psQueue->u32HasConsumer = FALSE;
+    psQueue->xConsumer = xConsumer;
+    psQueue->u32HasConsumer = TRUE;
+}
+
+void QUEUE_vidMpscClearConsumer(QUEUE_Mpsc_t * psQueue)
+{
+    psQueue->u32HasConsumer = FALSE;
+}
+
+/* ------------------------------------------------------------------------- */
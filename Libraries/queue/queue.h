@@ -0,0 +1,226 @@
+/*******************************************************************************
+ * @file    queue.h
+ * @brief   Lock-free ring buffer queues
+ * @details Fixed size item queues to pass data between interrupts and tasks,
+ *          without masking interrupts (unless the consumer is woken up, see below):
+ *          - SPSC (QUEUE_Spsc_t): a single producer and a single consumer, e.g. an
+ *            interrupt and a task. Push and pop are wait-free: each side only writes
+ *            its own index.
+ *          - MPSC (QUEUE_Mpsc_t): any number of producers, e.g. interrupts of different
+ *            priorities, and a single consumer. Producers reserve a slot by moving the
+ *            reserve index with LDREX/STREX, then publish the slot once the item is
+ *            written. An item interrupted by a higher priority producer delays the items
+ *            reserved after it, until it is published.
+ *
+ *          Queues and their storage are defined at compile time, the number of items
+ *          is a power of 2, so indexes are free running and masked:
+ *
+ *          @code
+ *          QUEUE_SPSC_DEFINE(adc_queue, uint16_t, 16);             // in a .c file
+ *
+ *          extern QUEUE_Spsc_t adc_queue;                          // in other files
+ *
+ *          QUEUE_u32SpscPush(&adc_queue, &sample);                 // in the ADC interrupt
+ *          while(QUEUE_u32SpscPop(&adc_queue, &sample)) { ... }    // in a task
+ *          @endcode
+ *
+ *          A queue can wake up its consumer: with QUEUE_vidSpscSetConsumer() (or
+ *          QUEUE_vidMpscSetConsumer()), each push releases the consumer event task
+ *          (OS_enReadyTask()), so the consumer doesn't poll an empty queue.
+ *          QUEUE_vidSpscClearConsumer() (or QUEUE_vidMpscClearConsumer()) stops it.
+ *          Waking up the consumer changes the scheduler's state in a Simple OS critical
+ *          section, which masks interrupts up to #OS_MAX_SYSCALL_PRIORITY: producers of a
+ *          queue with a consumer must have priority #OS_MAX_SYSCALL_PRIORITY or lower.
+ *          Producers of a queue without a consumer can have any priority.
+ * @date    18 Oct. 2026
+ * @author  Mohammad Mohsen
+ ******************************************************************************/
+
+#ifndef QUEUE_H_
+#define QUEUE_H_
+
+#include <stdint.h>
+
+#include "simple_os.h"
+
+/* ------------------------------------------------------------------------- */
+
+/**
+ * @addtogroup  queue Lock-free queues
+ * @{
+ * */
+
+/**
+ * @brief Single producer, single consumer queue
+ * */
+typedef struct queue_spsc_t {
+    uint8_t * const     pu8Buffer;      /**<  Items storage  */
+    const uint32_t      u32ItemSize;    /**<  Item size in bytes  */
+    const uint32_t      u32Mask;        /**<  Number of items - 1  */
+    volatile uint32_t   u32Write;       /**<  Write index (free running), moved by the producer  */
+    volatile uint32_t   u32Read;        /**<  Read index (free running), moved by the consumer  */
+    OS_TaskHandle_t     xConsumer;      /**<  Consumer task released by pushes, if u32HasConsumer is set  */
+    volatile uint32_t   u32HasConsumer; /**<  TRUE if pushes release xConsumer (the priority 0 task's handle is NULL)  */
+} QUEUE_Spsc_t;
+
+/**
+ * @brief Multiple producers, single consumer queue
+ * */
+typedef struct queue_mpsc_t {
+    uint8_t * const     pu8Buffer;      /**<  Items storage  */
+    volatile uint32_t * const pu32Sequence; /**<  Per slot: write index + 1 once published  */
+    const uint32_t      u32ItemSize;    /**<  Item size in bytes  */
+    const uint32_t      u32Mask;        /**<  Number of items - 1  */
+    volatile uint32_t   u32Reserve;     /**<  Reserve index (free running), moved by producers  */
+    volatile uint32_t   u32Read;        /**<  Read index (free running), moved by the consumer  */
+    volatile uint32_t   u32Dropped;     /**<  Items dropped because the queue was full  */
+    OS_TaskHandle_t     xConsumer;      /**<  Consumer task released by pushes, if u32HasConsumer is set  */
+    volatile uint32_t   u32HasConsumer; /**<  TRUE if pushes release xConsumer (the priority 0 task's handle is NULL)  */
+} QUEUE_Mpsc_t;
+
+/**
+ * @brief Compile time check of the number of items (power of 2)
+ * */
+#define QUEUE_SIZE_CHECK(xName, u32Size) \
+    typedef char xName##_size_must_be_a_power_of_2 [(((u32Size) >= 2u) && (((u32Size) & ((u32Size) - 1u)) == 0u)) ? 1 : -1]
+
+/**
+ * @brief Define a SPSC queue
+ *
+ * @param [in] xName   : queue name
+ * @param [in] xType   : item type
+ * @param [in] u32Size : number of items, power of 2
+ * */
+#define QUEUE_SPSC_DEFINE(xName, xType, u32Size) \
+    QUEUE_SIZE_CHECK(xName, u32Size); \
+    static uint32_t xName##_au32Buffer [((sizeof(xType) * (u32Size)) + 3u) / 4u]; \
+    QUEUE_Spsc_t xName = { \
+        .pu8Buffer      = (uint8_t *)xName##_au32Buffer, \
+        .u32ItemSize    = sizeof(xType), \
+        .u32Mask        = (u32Size) - 1u, \
+    }
+
+/**
+ * @brief Define a MPSC queue
+ *
+ * @param [in] xName   : queue name
+ * @param [in] xType   : item type
+ * @param [in] u32Size : number of items, power of 2
+ * */
+#define QUEUE_MPSC_DEFINE(xName, xType, u32Size) \
+    QUEUE_SIZE_CHECK(xName, u32Size); \
+    static uint32_t xName##_au32Buffer [((sizeof(xType) * (u32Size)) + 3u) / 4u]; \
+    static volatile uint32_t xName##_au32Sequence [u32Size]; \
+    QUEUE_Mpsc_t xName = { \
+        .pu8Buffer      = (uint8_t *)xName##_au32Buffer, \
+        .pu32Sequence   = xName##_au32Sequence, \
+        .u32ItemSize    = sizeof(xType), \
+        .u32Mask        = (u32Size) - 1u, \
+    }
+
+/* ------------------------------------------------------------------------- */
+
+/**
+ * @brief Push an item to a SPSC queue, from the producer only.
+ * Releases the consumer task if set (the producer's priority must then be
+ * #OS_MAX_SYSCALL_PRIORITY or lower, interrupts are masked up to it meanwhile).
+ *
+ * @param [in] psQueue : queue
+ * @param [in] pvItem  : item, copied to the queue
+ *
+ * @return TRUE if the item was pushed, FALSE if the queue is full
+ * */
+uint32_t QUEUE_u32SpscPush(QUEUE_Spsc_t * psQueue, const void * pvItem);
+
+/**
+ * @brief Pop the oldest item of a SPSC queue, from the consumer only
+ *
+ * @param [in]  psQueue : queue
+ * @param [out] pvItem  : item, copied from the queue
+ *
+ * @return TRUE if an item was popped, FALSE if the queue is empty
+ * */
+uint32_t QUEUE_u32SpscPop(QUEUE_Spsc_t * psQueue, void * pvItem);
+
+/**
+ * @brief Get the number of items in a SPSC queue
+ *
+ * @param [in] psQueue : queue
+ *
+ * @return Number of items
+ * */
+uint32_t QUEUE_u32SpscCount(const QUEUE_Spsc_t * psQueue);
+
+/**
+ * @brief Set the consumer task released by each push to a SPSC queue
+ *
+ * @param [in] psQueue   : queue
+ * @param [in] xConsumer : consumer task handle (usually an event task)
+ *
+ * @return void
+ * */
+void QUEUE_vidSpscSetConsumer(QUEUE_Spsc_t * psQueue, OS_TaskHandle_t xConsumer);
+
+/**
+ * @brief Stop releasing a consumer task on pushes to a SPSC queue
+ *
+ * @param [in] psQueue : queue
+ *
+ * @return void
+ * */
+void QUEUE_vidSpscClearConsumer(QUEUE_Spsc_t * psQueue);
+
+/**
+ * @brief Push an item to a MPSC queue, from any task or interrupt.
+ * Releases the consumer task if set (the producer's priority must then be
+ * #OS_MAX_SYSCALL_PRIORITY or lower, interrupts are masked up to it meanwhile).
+ *
+ * @param [in] psQueue : queue
+ * @param [in] pvItem  : item, copied to the queue
+ *
+ * @return TRUE if the item was pushed, FALSE if the queue is full (the item is counted as dropped)
+ * */
+uint32_t QUEUE_u32MpscPush(QUEUE_Mpsc_t * psQueue, const void * pvItem);
+
+/**
+ * @brief Pop the oldest published item of a MPSC queue, from the consumer only
+ *
+ * @param [in]  psQueue : queue
+ * @param [out] pvItem  : item, copied from the queue
+ *
+ * @return TRUE if an item was popped, FALSE if the queue is empty (or the oldest item
+ *         is not published yet)
+ * */
+uint32_t QUEUE_u32MpscPop(QUEUE_Mpsc_t * psQueue, void * pvItem);
+
+/**
+ * @brief Get the number of items dropped by a MPSC queue, and reset it
+ *
+ * @param [in] psQueue : queue
+ *
+ * @return Number of items dropped since the last call
+ * */
+uint32_t QUEUE_u32MpscDropped(QUEUE_Mpsc_t * psQueue);
+
+/**
+ * @brief Set the consumer task released by each push to a MPSC queue
+ *
+ * @param [in] psQueue   : queue
+ * @param [in] xConsumer : consumer task handle (usually an event task)
+ *
+ * @return void
+ * */
+void QUEUE_vidMpscSetConsumer(QUEUE_Mpsc_t * psQueue, OS_TaskHandle_t xConsumer);
+
+/**
+ * @brief Stop releasing a consumer task on pushes to a MPSC queue
+ *
+ * @param [in] psQueue : queue
+ *
+ * @return void
+ * */
+void QUEUE_vidMpscClearConsumer(QUEUE_Mpsc_t * psQueue);
+
+/**@}*/
+
+#endif /* QUEUE_H_ */
@@ -0,0 +1,59 @@
+/*******************************************************************************
+ * @file    seqlock.c
+ * @brief   Double buffered sequence lock
+ * @details Write & read, see seqlock.h
+ *
+ *          The active buffer is selected by the sequence's lowest bit. The writer
+ *          writes buffer (sequence + 1) & 1, then increments the sequence. A reader
+ *          copying buffer sequence & 1 is only overwritten by the second write after
+ *          it read the sequence, so the copy is valid if the sequence didn't change.
+ * @date    18 Oct. 2026
+ * @author  Mohammad Mohsen
+ ******************************************************************************/
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "main.h"
+
+#include "seqlock/seqlock.h"
+
+/* ------------------------------------------------------------------------- */
+
+void SEQLOCK_vidWrite(volatile uint32_t * pu32Sequence, void * pvBuffers, const void * pvValue, uint32_t u32Size)
+{
+    uint32_t Local_u32Sequence = *pu32Sequence;
+
+    memcpy((uint8_t *)pvBuffers + (((Local_u32Sequence + 1u) & 1u) * u32Size), pvValue, u32Size);
+
+    /*  switch buffers after the value is written  */
+    __DMB();
+    *pu32Sequence = Local_u32Sequence + 1u;
+}
+
+/* ------------------------------------------------------------------------- */
+
+uint32_t SEQLOCK_u32Read(const volatile uint32_t * pu32Sequence, const void * pvBuffers, void * pvValue, uint32_t u32Size)
+{
+    uint32_t Local_u32Retries = 0;
+    uint32_t Local_u32Sequence;
+
+    for(;;)
+    {
+        Local_u32Sequence = *pu32Sequence;
+
+        __DMB();
+        memcpy(pvValue, (const uint8_t *)pvBuffers + ((Local_u32Sequence & 1u) * u32Size), u32Size);
+        __DMB();
+
+        if(Local_u32Sequence == *pu32Sequence)
+        {
+            return Local_u32Retries;
+        }
+
+        Local_u32Retries++;
+    }
+}
+
+/* ------------------------------------------------------------------------- */
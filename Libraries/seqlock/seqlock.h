@@ -0,0 +1,116 @@
+/*******************************************************************************
+ * @file    seqlock.h
+ * @brief   Double buffered sequence lock
+ * @details Shares a multi-word value (e.g. a timestamp and a sample) between a
+ *          writer and readers without masking interrupts:
+ *          - the writer never waits: it writes the inactive buffer, then increments
+ *            the sequence, which makes that buffer the active one
+ *          - a reader copies the active buffer, and retries if the sequence changed
+ *            during the copy
+ *
+ *          A reader that preempts the writer (e.g. an interrupt reading a value written
+ *          by a task) never retries, as the writer is writing the inactive buffer.
+ *          A reader preempted by the writer retries, at most once per write.
+ *          There's a single writer (or writers that don't preempt each other).
+ *
+ *          Each instance holds a fixed type, and gets typed write and read functions.
+ *          The type's size is checked at compile time (#SEQLOCK_MAX_SIZE), as it
+ *          bounds the copy time, hence the readers' retry window:
+ *
+ *          @code
+ *          typedef struct { uint32_t timestamp; int32_t sample[3]; } Sample_t;
+ *
+ *          SEQLOCK_DECLARE(imu_sample, Sample_t)      // in a header, no semicolon
+ *          SEQLOCK_DEFINE(imu_sample);                // in a single .c file
+ *
+ *          imu_sample_vidWrite(&sample);              // writer, e.g. in the IMU interrupt
+ *          imu_sample_u32Read(&sample);               // readers
+ *          @endcode
+ *
+ *          Configuration (board_config.h):
+ *          - CONF_SEQLOCK_MAX_SIZE : largest value size in bytes (default 64)
+ * @date    18 Oct. 2026
+ * @author  Mohammad Mohsen
+ ******************************************************************************/
+
+#ifndef SEQLOCK_H_
+#define SEQLOCK_H_
+
+#include <stdint.h>
+
+#include "board_config.h"
+
+/* ------------------------------------------------------------------------- */
+
+/**
+ * @addtogroup  seqlock Sequence lock
+ * @{
+ * */
+
+#ifdef CONF_SEQLOCK_MAX_SIZE
+#define SEQLOCK_MAX_SIZE            CONF_SEQLOCK_MAX_SIZE
+#else
+#define SEQLOCK_MAX_SIZE            64u
+#endif  /*  CONF_SEQLOCK_MAX_SIZE  */
+
+/**
+ * @brief Declare a sequence lock holding values of a type, and its typed functions:
+ * - `void <name>_vidWrite(const xType * pxValue)`
+ * - `uint32_t <name>_u32Read(xType * pxValue)`, returns the number of retries
+ *
+ * @param [in] xName : sequence lock name
+ * @param [in] xType : value type, at most #SEQLOCK_MAX_SIZE bytes
+ * */
+#define SEQLOCK_DECLARE(xName, xType) \
+    typedef char xName##_size_must_not_exceed_SEQLOCK_MAX_SIZE [(sizeof(xType) <= SEQLOCK_MAX_SIZE) ? 1 : -1]; \
+    typedef struct xName##_seqlock_t { \
+        volatile uint32_t   u32Sequence; \
+        xType               axBuffers [2]; \
+    } xName##_Seqlock_t; \
+    extern xName##_Seqlock_t xName; \
+    static inline void xName##_vidWrite(const xType * pxValue) \
+    { \
+        SEQLOCK_vidWrite(&xName.u32Sequence, xName.axBuffers, pxValue, sizeof(xType)); \
+    } \
+    static inline uint32_t xName##_u32Read(xType * pxValue) \
+    { \
+        return SEQLOCK_u32Read(&xName.u32Sequence, xName.axBuffers, pxValue, sizeof(xType)); \
+    }
+
+/**
+ * @brief Define a sequence lock declared by SEQLOCK_DECLARE()
+ *
+ * @param [in] xName : sequence lock name
+ * */
+#define SEQLOCK_DEFINE(xName) \
+    xName##_Seqlock_t xName
+
+/* ------------------------------------------------------------------------- */
+
+/**
+ * @brief Write a value (use the typed <name>_vidWrite() function)
+ *
+ * @param [in] pu32Sequence : sequence
+ * @param [in] pvBuffers    : 2 buffers of @p u32Size bytes
+ * @param [in] pvValue      : value
+ * @param [in] u32Size      : value size in bytes
+ *
+ * @return void
+ * */
+void SEQLOCK_vidWrite(volatile uint32_t * pu32Sequence, void * pvBuffers, const void * pvValue, uint32_t u32Size);
+
+/**
+ * @brief Read the last written value (use the typed <name>_u32Read() function)
+ *
+ * @param [in]  pu32Sequence : sequence
+ * @param [in]  pvBuffers    : 2 buffers of @p u32Size bytes
+ * @param [out] pvValue      : value
+ * @param [in]  u32Size      : value size in bytes
+ *
+ * @return Number of retries, the copy was interrupted by a write
+ * */
+uint32_t SEQLOCK_u32Read(const volatile uint32_t * pu32Sequence, const void * pvBuffers, void * pvValue, uint32_t u32Size);
+
+/**@}*/
+
+#endif /* SEQLOCK_H_ */
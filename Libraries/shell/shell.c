@@ -0,0 +1,423 @@
+/*******************************************************************************
+ * @file    shell.c
+ * @brief   Non-blocking command shell
+ * @details Line editing, command lookup & output, see shell.h
+ *
+ *          Commands are looked up in a perfect hash table (shell_table.h): the slot
+ *          is the top bits of the FNV-1a hash of the command name, with an offset
+ *          basis (seed) chosen by Tools/gen_shell_cmds.py so that no two commands
+ *          share a slot.
+ * @date    18 Oct. 2026
+ * @author  Mohammad Mohsen
+ ******************************************************************************/
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "utils/utils.h"
+#include "utils/fmt.h"
+
+#include "uart/uart_rx.h"
+#include "uart/uart_tx.h"
+#include "shell/shell.h"
+#include "shell/shell_table.h"
+
+/* ------------------------------------------------------------------------- */
+
+/**
+ * @brief Prompt, printed when the shell is ready for a command line
+ * */
+#define SHELL_PROMPT                "> "
+
+/**
+ * @brief FNV-1a prime
+ * */
+#define SHELL_HASH_PRIME            0x01000193u
+
+/* ------------------------------------------------------------------------- */
+
+/**
+ * Command line
+ * */
+static char SHELL_acLine [SHELL_LINE_SIZE];
+
+/**
+ * Command line length
+ * */
+static uint32_t SHELL_u32LineSize;
+
+/**
+ * Last received character, to handle CR LF line endings
+ * */
+static char SHELL_cLast;
+
+/**
+ * Bytes of the first received frame already handled
+ * */
+static uint32_t SHELL_u32FrameOffset;
+
+/**
+ * Running command, NULL if none
+ * */
+static SHELL_u32Command_t SHELL_pfCommand;
+
+/**
+ * Running command's words
+ * */
+static char * SHELL_apcArgv [SHELL_MAX_ARGS];
+
+/**
+ * Running command's number of words
+ * */
+static uint32_t SHELL_u32Argc;
+
+/**
+ * Running command's next step
+ * */
+static uint32_t SHELL_u32Step;
+
+/**
+ * Output not queued to the transmit channel yet
+ * */
+static char SHELL_acOutput [SHELL_OUTPUT_SIZE];
+
+/**
+ * Output size
+ * */
+static uint32_t SHELL_u32OutputSize;
+
+/* ------------------------------------------------------------------------- */
+
+/**
+ * @brief Get a command name's slot in the command table
+ * */
+static uint32_t SHELL_u32Hash(const char * pcName)
+{
+    uint32_t Local_u32Hash = SHELL_HASH_SEED;
+
+    while(*pcName)
+    {
+        Local_u32Hash = (Local_u32Hash ^ (uint8_t)*pcName++) * SHELL_HASH_PRIME;
+    }
+
+    return Local_u32Hash >> SHELL_HASH_SHIFT;
+}
+
+/**
+ * @brief Queue the output to the transmit channel
+ *
+ * @return TRUE if the output is queued (or empty), FALSE if the transmit buffer is full
+ * */
+static uint32_t SHELL_u32Flush(void)
+{
+    if(IS_ZERO(SHELL_u32OutputSize))
+    {
+        return TRUE;
+    }
+
+    if(IS_ZERO(UART_u32TxWrite((const uint8_t *)SHELL_acOutput, SHELL_u32OutputSize)))
+    {
+        return FALSE;
+    }
+
+    SHELL_u32OutputSize = 0;
+
+    return TRUE;
+}
+
+/**
+ * @brief Split the command line into words, and start its command
+ * */
+static void SHELL_vidExecute(void)
+{
+    const SHELL_Command_t * Local_psCommand;
+    char * Local_pcWord = SHELL_acLine;
+
+    SHELL_acLine[SHELL_u32LineSize] = '\0';
+    SHELL_u32LineSize = 0;
+    SHELL_u32Argc = 0;
+
+    while(*Local_pcWord)
+    {
+        if(*Local_pcWord == ' ')
+        {
+            *Local_pcWord++ = '\0';
+            continue;
+        }
+
+        if(SHELL_u32Argc == SHELL_MAX_ARGS)
+        {
+            SHELL_vidPrint("too many arguments\r\n" SHELL_PROMPT);
+            return;
+        }
+
+        SHELL_apcArgv[SHELL_u32Argc++] = Local_pcWord;
+
+        while(*Local_pcWord && (*Local_pcWord != ' '))
+        {
+            Local_pcWord++;
+        }
+    }
+
+    if(IS_ZERO(SHELL_u32Argc))
+    {
+        SHELL_vidPrint(SHELL_PROMPT);
+        return;
+    }
+
+    Local_psCommand = &SHELL_asCommands[SHELL_u32Hash(SHELL_apcArgv[0])];
+
+    if(IS_NULLPTR(Local_psCommand->pcName) || strcmp(Local_psCommand->pcName, SHELL_apcArgv[0]))
+    {
+        SHELL_vidPrint("unknown command: ");
+        SHELL_vidPrint(SHELL_apcArgv[0]);
+        SHELL_vidPrint(", try help\r\n" SHELL_PROMPT);
+        return;
+    }
+
+    /*  first step is run by the next execution of the shell task  */
+    SHELL_pfCommand = Local_psCommand->pfHandler;
+    SHELL_u32Step = 0;
+}
+
+/**
+ * @brief Handle a received character
+ * */
+static void SHELL_vidInput(char cInput)
+{
+    char Local_cLast = SHELL_cLast;
+
+    SHELL_cLast = cInput;
+
+    if((cInput == '\r') || ((cInput == '\n') && (Local_cLast != '\r')))
+    {
+        SHELL_vidPrint("\r\n");
+        SHELL_vidExecute();
+    }
+    else if((cInput == '\b') || (cInput == 0x7F))
+    {
+        if(SHELL_u32LineSize)
+        {
+            SHELL_u32LineSize--;
+            SHELL_vidPrint("\b \b");
+        }
+    }
+    else if((cInput >= ' ') && (cInput <= '~') && (SHELL_u32LineSize < (SHELL_LINE_SIZE - 1u)))
+    {
+        /*  echo  */
+        SHELL_acLine[SHELL_u32LineSize++] = cInput;
+
+        if(SHELL_u32OutputSize < SHELL_OUTPUT_SIZE)
+        {
+            SHELL_acOutput[SHELL_u32OutputSize++] = cInput;
+        }
+    }
+}
+
+/**
+ * @brief Handle received characters, up to the end of a command line
+ * */
+static void SHELL_vidRead(void)
+{
+    UART_RxFrame_t Local_sFrame;
+    uint32_t Local_u32Size;
+    uint32_t Local_u32Idx;
+
+    while(IS_NULLPTR(SHELL_pfCommand) && UART_u32RxGetFrame(&Local_sFrame))
+    {
+        Local_u32Size = Local_sFrame.u32Size[0] + Local_sFrame.u32Size[1];
+
+        for(Local_u32Idx = SHELL_u32FrameOffset; (Local_u32Idx < Local_u32Size) && IS_NULLPTR(SHELL_pfCommand); Local_u32Idx++)
+        {
+            if(Local_u32Idx < Local_sFrame.u32Size[0])
+            {
+                SHELL_vidInput((char)Local_sFrame.pu8Data[0][Local_u32Idx]);
+            }
+            else
+            {
+                SHELL_vidInput((char)Local_sFrame.pu8Data[1][Local_u32Idx - Local_sFrame.u32Size[0]]);
+            }
+        }
+
+        /*  rest of the frame is read once the command is done  */
+        if(Local_u32Idx < Local_u32Size)
+        {
+            SHELL_u32FrameOffset = Local_u32Idx;
+        }
+        else
+        {
+            SHELL_u32FrameOffset = 0;
+            UART_u32RxReleaseFrame();
+        }
+    }
+}
+
+/* ------------------------------------------------------------------------- */
+
+void SHELL_vidInitialize(void)
+{
+    SHELL_u32LineSize       = 0;
+    SHELL_cLast             = '\0';
+    SHELL_u32FrameOffset    = 0;
+    SHELL_pfCommand         = NULL;
+    SHELL_u32OutputSize     = 0;
+
+    SHELL_vidPrint("\r\n" SHELL_PROMPT);
+}
+
+/* ------------------------------------------------------------------------- */
+
+void SHELL_vidTask(void * const pvArgs)
+{
+    (void)pvArgs;
+
+    /*  a step's output is queued before the next step is run  */
+    if(!SHELL_u32Flush())
+    {
+        return;
+    }
+
+    if(!IS_NULLPTR(SHELL_pfCommand))
+    {
+        if(!SHELL_pfCommand(SHELL_u32Argc, SHELL_apcArgv, SHELL_u32Step++))
+        {
+            SHELL_pfCommand = NULL;
+            SHELL_vidPrint(SHELL_PROMPT);
+        }
+    }
+    else
+    {
+        SHELL_vidRead();
+    }
+
+    (void)SHELL_u32Flush();
+}
+
+/* ------------------------------------------------------------------------- */
+
+void SHELL_vidPrint(const char * pcString)
+{
+    while(*pcString && (SHELL_u32OutputSize < SHELL_OUTPUT_SIZE))
+    {
+        SHELL_acOutput[SHELL_u32OutputSize++] = *pcString++;
+    }
+}
+
+/* ------------------------------------------------------------------------- */
+
+void SHELL_vidPrintUnsigned(uint32_t u32Value, uint32_t u32Width)
+{
+    char Local_acDigits[FMT_UNSIGNED_MAX_SIZE + 1u];
+    uint32_t Local_u32Size = FMT_u32Unsigned(Local_acDigits, u32Value);
+
+    Local_acDigits[Local_u32Size] = '\0';
+
+    for(; u32Width > Local_u32Size; u32Width--)
+    {
+        SHELL_vidPrint(" ");
+    }
+
+    SHELL_vidPrint(Local_acDigits);
+}
+
+/* ------------------------------------------------------------------------- */
+
+void SHELL_vidPrintHex(uint32_t u32Value, uint32_t u32Digits)
+{
+    char Local_acDigits[FMT_HEX_MAX_SIZE + 1u];
+
+    Local_acDigits[FMT_u32Hex(Local_acDigits, u32Value, MAX(u32Digits, 1u))] = '\0';
+
+    SHELL_vidPrint(Local_acDigits);
+}
+
+/* ------------------------------------------------------------------------- */
+
+uint32_t SHELL_u32ParseUnsigned(const char * pcString, uint32_t * pu32Value)
+{
+    uint32_t Local_u32Value = 0;
+    uint32_t Local_u32Base = 10;
+    uint32_t Local_u32Digit;
+
+    if(IS_NULLPTR(pcString) || IS_NULLPTR(pu32Value) || IS_ZERO(*pcString))
+    {
+        return FALSE;
+    }
+
+    if((pcString[0] == '0') && ((pcString[1] == 'x') || (pcString[1] == 'X')) && pcString[2])
+    {
+        Local_u32Base = 16;
+        pcString += 2;
+    }
+
+    for(; *pcString; pcString++)
+    {
+        if((*pcString >= '0') && (*pcString <= '9'))
+        {
+            Local_u32Digit = (uint32_t)(*pcString - '0');
+        }
+        else if((Local_u32Base == 16u) && (*pcString >= 'a') && (*pcString <= 'f'))
+        {
+            Local_u32Digit = (uint32_t)(*pcString - 'a') + 10u;
+        }
+        else if((Local_u32Base == 16u) && (*pcString >= 'A') && (*pcString <= 'F'))
+        {
+            Local_u32Digit = (uint32_t)(*pcString - 'A') + 10u;
+        }
+        else
+        {
+            return FALSE;
+        }
+
+        if(Local_u32Value > ((UINT32_MAX - Local_u32Digit) / Local_u32Base))
+        {
+            return FALSE;
+        }
+
+        Local_u32Value = (Local_u32Value * Local_u32Base) + Local_u32Digit;
+    }
+
+    *pu32Value = Local_u32Value;
+
+    return TRUE;
+}
+
+/* ------------------------------------------------------------------------- */
+
+uint32_t SHELL_u32CmdHelp(uint32_t u32Argc, char * const apcArgv[], uint32_t u32Step)
+{
+    uint32_t Local_u32Idx;
+    uint32_t Local_u32Count = 0;
+
+    (void)u32Argc;
+    (void)apcArgv;
+
+    /*  one command per step, in table order  */
+    for(Local_u32Idx = 0; Local_u32Idx < SHELL_TABLE_SIZE; Local_u32Idx++)
+    {
+        if(IS_NULLPTR(SHELL_asCommands[Local_u32Idx].pcName))
+        {
+            continue;
+        }
+
+        if(Local_u32Count == u32Step)
+        {
+            SHELL_vidPrint("  ");
+            SHELL_vidPrint(SHELL_asCommands[Local_u32Idx].pcName);
+            SHELL_vidPrint("\t");
+            SHELL_vidPrint(SHELL_asCommands[Local_u32Idx].pcHelp);
+            SHELL_vidPrint("\r\n");
+        }
+        else if(Local_u32Count > u32Step)
+        {
+            return TRUE;
+        }
+
+        Local_u32Count++;
+    }
+
+    return FALSE;
+}
+
+/* ------------------------------------------------------------------------- */
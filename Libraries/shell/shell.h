@@ -0,0 +1,154 @@
+/*******************************************************************************
+ * @file    shell.h
+ * @brief   Non-blocking command shell
+ * @details Command interpreter on USART1 (uart_rx.h & uart_tx.h), for live
+ *          scheduler introspection and tuning: list tasks and statistics, change
+ *          periods and offsets, suspend and resume tasks, dump the trace buffer.
+ *
+ *          The shell runs as a low priority periodic task, and never blocks the
+ *          dispatcher: each execution handles received characters up to the end of
+ *          a command line, or runs one step of the current command.
+ *
+ *          @code
+ *          UART_vidTxInit(115200);
+ *          UART_vidRxInit(115200, NULL);
+ *          SHELL_vidInitialize();
+ *
+ *          OS_enAddTask(SHELL_vidTask, NULL, OS_TASK_COUNT - 1, OS_MS_TO_TICKS(20), 0, &shell_handle);
+ *          @endcode
+ *
+ *          Commands are listed in shell_cmds.def, and looked up in a perfect hash table
+ *          generated by Tools/gen_shell_cmds.py (shell_table.h): one hash of the typed
+ *          word and one string compare, whatever the number of commands.
+ *
+ *          A command handler is called with the command line's words, and a step number
+ *          starting at 0. It writes at most #SHELL_OUTPUT_SIZE bytes per step using the
+ *          SHELL_vidPrintxxx() functions, and returns TRUE to be called again with the next
+ *          step, e.g. to print one line per task. The next step is run once the output
+ *          is queued to the transmit channel, so output is never lost when the transmit
+ *          buffer is full, and the next command line is read once the command is done.
+ *
+ *          Configuration (board_config.h):
+ *          - CONF_SHELL_LINE_SIZE : command line size (default 64)
+ *          - CONF_SHELL_OUTPUT_SIZE : output size per command step (default 128)
+ *          - CONF_SHELL_MAX_ARGS : maximum number of words in a command line (default 4)
+ * @date    18 Oct. 2026
+ * @author  Mohammad Mohsen
+ ******************************************************************************/
+
+#ifndef SHELL_H_
+#define SHELL_H_
+
+#include <stdint.h>
+
+#include "board_config.h"
+
+/* ------------------------------------------------------------------------- */
+
+/**
+ * @addtogroup  shell Command shell
+ * @{
+ * */
+
+#ifdef CONF_SHELL_LINE_SIZE
+#define SHELL_LINE_SIZE             CONF_SHELL_LINE_SIZE
+#else
+#define SHELL_LINE_SIZE             64u
+#endif  /*  CONF_SHELL_LINE_SIZE  */
+
+#ifdef CONF_SHELL_OUTPUT_SIZE
+#define SHELL_OUTPUT_SIZE           CONF_SHELL_OUTPUT_SIZE
+#else
+#define SHELL_OUTPUT_SIZE           128u
+#endif  /*  CONF_SHELL_OUTPUT_SIZE  */
+
+#ifdef CONF_SHELL_MAX_ARGS
+#define SHELL_MAX_ARGS              CONF_SHELL_MAX_ARGS
+#else
+#define SHELL_MAX_ARGS              4u
+#endif  /*  CONF_SHELL_MAX_ARGS  */
+
+/**
+ * @brief Command handler
+ *
+ * @param [in] u32Argc  : number of words in the command line, including the command name
+ * @param [in] apcArgv  : command line's words, apcArgv[0] is the command name
+ * @param [in] u32Step  : step number, 0 at the first call
+ *
+ * @return TRUE to be called again with the next step, FALSE when the command is done
+ * */
+typedef uint32_t (*SHELL_u32Command_t)(uint32_t u32Argc, char * const apcArgv[], uint32_t u32Step);
+
+/**
+ * @brief Command table entry
+ * */
+typedef struct shell_command_t {
+    const char *        pcName;     /**<  Command name, NULL for an empty slot  */
+    SHELL_u32Command_t  pfHandler;  /**<  Command handler  */
+    const char *        pcHelp;     /**<  Help text  */
+} SHELL_Command_t;
+
+/* ------------------------------------------------------------------------- */
+
+/**
+ * @brief Initialize the shell, and print the prompt
+ *
+ * @param void
+ *
+ * @pre UART_vidTxInit() and UART_vidRxInit() are called
+ *
+ * @return void
+ * */
+void SHELL_vidInitialize(void);
+
+/**
+ * @brief Shell task handler, added as a low priority periodic task
+ *
+ * @param [in] pvArgs : unused
+ *
+ * @return void
+ * */
+void SHELL_vidTask(void * const pvArgs);
+
+/**
+ * @brief Append a string to the command step's output
+ *
+ * @param [in] pcString : string
+ *
+ * @return void
+ * */
+void SHELL_vidPrint(const char * pcString);
+
+/**
+ * @brief Append an unsigned decimal number to the command step's output
+ *
+ * @param [in] u32Value : value
+ * @param [in] u32Width : minimum width, padded with spaces on the left
+ *
+ * @return void
+ * */
+void SHELL_vidPrintUnsigned(uint32_t u32Value, uint32_t u32Width);
+
+/**
+ * @brief Append a hexadecimal number to the command step's output
+ *
+ * @param [in] u32Value  : value
+ * @param [in] u32Digits : number of digits, [1: 8]
+ *
+ * @return void
+ * */
+void SHELL_vidPrintHex(uint32_t u32Value, uint32_t u32Digits);
+
+/**
+ * @brief Parse an unsigned decimal, or hexadecimal (`0x` prefix) number
+ *
+ * @param [in]  pcString : string
+ * @param [out] pu32Value : parsed value
+ *
+ * @return TRUE if the string is a valid number, FALSE otherwise
+ * */
+uint32_t SHELL_u32ParseUnsigned(const char * pcString, uint32_t * pu32Value);
+
+/**@}*/
+
+#endif /* SHELL_H_ */
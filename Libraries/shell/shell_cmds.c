@@ -0,0 +1,372 @@
+/*******************************************************************************
+ * @file    shell_cmds.c
+ * @brief   Shell scheduler commands
+ * @details Scheduler introspection & tuning commands, listed in shell_cmds.def.
+ *          Tasks are designated by their priority. Statistics commands print a
+ *          message when their Simple OS module is disabled.
+ * @date    18 Oct. 2026
+ * @author  Mohammad Mohsen
+ ******************************************************************************/
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "utils/utils.h"
+
+#include "simple_os.h"
+
+#if OS_USE_TASK_PROFILING
+#include "simple_os_prof.h"
+#endif /*  OS_USE_TASK_PROFILING  */
+
+#if OS_USE_CPU_LOAD
+#include "simple_os_load.h"
+#endif /*  OS_USE_CPU_LOAD  */
+
+#if OS_USE_OVERHEAD_ACCOUNTING
+#include "simple_os_overhead.h"
+#endif /*  OS_USE_OVERHEAD_ACCOUNTING  */
+
+#if OS_USE_TRACE
+#include "simple_os_trace.h"
+#endif /*  OS_USE_TRACE  */
+
+#include "shell/shell.h"
+#include "shell/shell_table.h"
+
+/* ------------------------------------------------------------------------- */
+
+/**
+ * @brief Trace bytes printed per step
+ * */
+#define SHELL_TRACE_LINE_BYTES      32u
+
+/* ------------------------------------------------------------------------- */
+
+/**
+ * @brief Get the task at a priority, print an error if there is none
+ * */
+static uint32_t SHELL_u32GetTask(const char * pcPriority, OS_TaskInfo_t * psInfo)
+{
+    uint32_t Local_u32Priority;
+
+    if(!SHELL_u32ParseUnsigned(pcPriority, &Local_u32Priority) || (OS_enGetTaskInfo(Local_u32Priority, psInfo) != OS_ERROR_NONE))
+    {
+        SHELL_vidPrint("no task at priority ");
+        SHELL_vidPrint(pcPriority);
+        SHELL_vidPrint("\r\n");
+        return FALSE;
+    }
+
+    return TRUE;
+}
+
+/**
+ * @brief Parse a number of ticks, print an error if it's not valid
+ * */
+static uint32_t SHELL_u32GetTicks(const char * pcTicks, OS_Tick_t * pxTicks)
+{
+    uint32_t Local_u32Ticks;
+
+    if(!SHELL_u32ParseUnsigned(pcTicks, &Local_u32Ticks) || ((OS_Tick_t)Local_u32Ticks != Local_u32Ticks))
+    {
+        SHELL_vidPrint("invalid ticks: ");
+        SHELL_vidPrint(pcTicks);
+        SHELL_vidPrint("\r\n");
+        return FALSE;
+    }
+
+    *pxTicks = (OS_Tick_t)Local_u32Ticks;
+
+    return TRUE;
+}
+
+#if OS_USE_CPU_LOAD || OS_USE_OVERHEAD_ACCOUNTING
+/**
+ * @brief Print a permille value as a percentage
+ * */
+static void SHELL_vidPrintPermille(const char * pcName, uint32_t u32Permille)
+{
+    SHELL_vidPrint(pcName);
+    SHELL_vidPrintUnsigned(u32Permille / 10u, 4);
+    SHELL_vidPrint(".");
+    SHELL_vidPrintUnsigned(u32Permille % 10u, 1);
+    SHELL_vidPrint("%");
+}
+#endif /*  OS_USE_CPU_LOAD || OS_USE_OVERHEAD_ACCOUNTING  */
+
+/* ------------------------------------------------------------------------- */
+
+uint32_t SHELL_u32CmdTasks(uint32_t u32Argc, char * const apcArgv[], uint32_t u32Step)
+{
+    OS_TaskInfo_t Local_sInfo;
+
+    (void)u32Argc;
+    (void)apcArgv;
+
+    /*  header, then one task per step  */
+    if(IS_ZERO(u32Step))
+    {
+        SHELL_vidPrint("prio  type      state   period    next  jobs  handler\r\n");
+        return TRUE;
+    }
+
+    if(OS_enGetTaskInfo(u32Step - 1u, &Local_sInfo) == OS_ERROR_NONE)
+    {
+        SHELL_vidPrintUnsigned(u32Step - 1u, 4);
+
+        if(Local_sInfo.state & OS_TASK_STATE_EVENT)
+        {
+            SHELL_vidPrint("  event   ");
+        }
+        else if(Local_sInfo.state & OS_TASK_STATE_ONESHOT)
+        {
+            SHELL_vidPrint("  oneshot ");
+        }
+        else
+        {
+            SHELL_vidPrint("  periodic");
+        }
+
+        SHELL_vidPrint((Local_sInfo.state & OS_TASK_STATE_SUSPENDED) ? "  susp  " : "  active");
+        SHELL_vidPrintUnsigned(Local_sInfo.period, 8);
+        SHELL_vidPrintUnsigned(Local_sInfo.delay, 8);
+        SHELL_vidPrintUnsigned(Local_sInfo.jobs, 6);
+        SHELL_vidPrint("  0x");
+        SHELL_vidPrintHex((uint32_t)(uintptr_t)Local_sInfo.handler, 8);
+        SHELL_vidPrint("\r\n");
+    }
+
+    return (u32Step < OS_TASK_COUNT);
+}
+
+/* ------------------------------------------------------------------------- */
+
+uint32_t SHELL_u32CmdStats(uint32_t u32Argc, char * const apcArgv[], uint32_t u32Step)
+{
+#if OS_USE_TASK_PROFILING
+    OS_TaskInfo_t Local_sInfo;
+    OS_TaskStats_t Local_sStats;
+
+    (void)u32Argc;
+    (void)apcArgv;
+
+    if(IS_ZERO(u32Step))
+    {
+        SHELL_vidPrint("prio      runs  overruns  exec_min exec_mean  exec_max  lat_mean   lat_max\r\n");
+        return TRUE;
+    }
+
+    if((OS_enGetTaskInfo(u32Step - 1u, &Local_sInfo) == OS_ERROR_NONE) &&
+       (OS_enGetTaskStats(u32Step - 1u, &Local_sStats) == OS_ERROR_NONE))
+    {
+        SHELL_vidPrintUnsigned(u32Step - 1u, 4);
+        SHELL_vidPrintUnsigned(Local_sStats.runs, 10);
+        SHELL_vidPrintUnsigned(Local_sStats.overruns, 10);
+        SHELL_vidPrintUnsigned(Local_sStats.exec_min, 10);
+        SHELL_vidPrintUnsigned(Local_sStats.exec_mean, 10);
+        SHELL_vidPrintUnsigned(Local_sStats.exec_max, 10);
+        SHELL_vidPrintUnsigned(Local_sStats.latency_mean, 10);
+        SHELL_vidPrintUnsigned(Local_sStats.latency_max, 10);
+        SHELL_vidPrint("\r\n");
+    }
+
+    return (u32Step < OS_TASK_COUNT);
+#else
+    (void)u32Argc;
+    (void)apcArgv;
+    (void)u32Step;
+
+    SHELL_vidPrint("task profiling is disabled (CONF_OS_USE_TASK_PROFILING)\r\n");
+
+    return FALSE;
+#endif /*  OS_USE_TASK_PROFILING  */
+}
+
+/* ------------------------------------------------------------------------- */
+
+uint32_t SHELL_u32CmdLoad(uint32_t u32Argc, char * const apcArgv[], uint32_t u32Step)
+{
+#if OS_USE_CPU_LOAD
+    OS_CpuLoad_t Local_sLoad;
+#endif /*  OS_USE_CPU_LOAD  */
+#if OS_USE_OVERHEAD_ACCOUNTING
+    OS_Overhead_t Local_sOverhead;
+    uint32_t Local_u32Total;
+#endif /*  OS_USE_OVERHEAD_ACCOUNTING  */
+
+    (void)u32Argc;
+    (void)apcArgv;
+
+    if(IS_ZERO(u32Step))
+    {
+#if OS_USE_CPU_LOAD
+        (void)OS_enGetCpuLoad(&Local_sLoad);
+
+        SHELL_vidPrintPermille("load    current", Local_sLoad.current);
+        SHELL_vidPrintPermille("  long", Local_sLoad.longterm);
+        SHELL_vidPrintPermille("  peak", Local_sLoad.peak);
+        SHELL_vidPrintPermille("  avg", Local_sLoad.ewma);
+        SHELL_vidPrint("\r\n");
+#else
+        SHELL_vidPrint("CPU load is disabled (CONF_OS_USE_CPU_LOAD)\r\n");
+#endif /*  OS_USE_CPU_LOAD  */
+
+        return TRUE;
+    }
+
+#if OS_USE_OVERHEAD_ACCOUNTING
+    (void)OS_enGetOverhead(&Local_sOverhead);
+
+    /*  permille of the window, 0 until the first window is completed  */
+    Local_u32Total = MAX(Local_sOverhead.total / 1000u, 1u);
+
+    SHELL_vidPrintPermille("cpu     update ", Local_sOverhead.update / Local_u32Total);
+    SHELL_vidPrintPermille("  dispatch", Local_sOverhead.dispatch / Local_u32Total);
+    SHELL_vidPrintPermille("  tasks", Local_sOverhead.tasks / Local_u32Total);
+    SHELL_vidPrintPermille("  idle", Local_sOverhead.idle / Local_u32Total);
+    SHELL_vidPrintPermille("  unaccounted", Local_sOverhead.unaccounted / Local_u32Total);
+    SHELL_vidPrint("  (");
+    SHELL_vidPrintUnsigned(Local_sOverhead.ticks, 0);
+    SHELL_vidPrint(" ticks)\r\n");
+#else
+    SHELL_vidPrint("overhead accounting is disabled (CONF_OS_USE_OVERHEAD_ACCOUNTING)\r\n");
+#endif /*  OS_USE_OVERHEAD_ACCOUNTING  */
+
+    return FALSE;
+}
+
+/* ------------------------------------------------------------------------- */
+
+uint32_t SHELL_u32CmdPeriod(uint32_t u32Argc, char * const apcArgv[], uint32_t u32Step)
+{
+    OS_TaskInfo_t Local_sInfo;
+    OS_Tick_t Local_xTicks;
+
+    (void)u32Step;
+
+    if(u32Argc != 3u)
+    {
+        SHELL_vidPrint("usage: period <prio> <ticks>\r\n");
+        return FALSE;
+    }
+
+    if(SHELL_u32GetTask(apcArgv[1], &Local_sInfo) && SHELL_u32GetTicks(apcArgv[2], &Local_xTicks))
+    {
+        if(OS_enSetTaskPeriod(Local_sInfo.handle, Local_xTicks) != OS_ERROR_NONE)
+        {
+            SHELL_vidPrint("task is not periodic, or period is 0\r\n");
+        }
+    }
+
+    return FALSE;
+}
+
+/* ------------------------------------------------------------------------- */
+
+uint32_t SHELL_u32CmdOffset(uint32_t u32Argc, char * const apcArgv[], uint32_t u32Step)
+{
+    OS_TaskInfo_t Local_sInfo;
+    OS_Tick_t Local_xTicks;
+
+    (void)u32Step;
+
+    if(u32Argc != 3u)
+    {
+        SHELL_vidPrint("usage: offset <prio> <ticks>\r\n");
+        return FALSE;
+    }
+
+    if(SHELL_u32GetTask(apcArgv[1], &Local_sInfo) && SHELL_u32GetTicks(apcArgv[2], &Local_xTicks))
+    {
+        if(OS_enSetTaskDelay(Local_sInfo.handle, Local_xTicks) != OS_ERROR_NONE)
+        {
+            SHELL_vidPrint("event tasks have no offset\r\n");
+        }
+    }
+
+    return FALSE;
+}
+
+/* ------------------------------------------------------------------------- */
+
+uint32_t SHELL_u32CmdSuspend(uint32_t u32Argc, char * const apcArgv[], uint32_t u32Step)
+{
+    OS_TaskInfo_t Local_sInfo;
+
+    (void)u32Step;
+
+    if(u32Argc != 2u)
+    {
+        SHELL_vidPrint("usage: suspend <prio>\r\n");
+        return FALSE;
+    }
+
+    if(SHELL_u32GetTask(apcArgv[1], &Local_sInfo))
+    {
+        (void)OS_enSuspendTask(Local_sInfo.handle);
+    }
+
+    return FALSE;
+}
+
+/* ------------------------------------------------------------------------- */
+
+uint32_t SHELL_u32CmdResume(uint32_t u32Argc, char * const apcArgv[], uint32_t u32Step)
+{
+    OS_TaskInfo_t Local_sInfo;
+
+    (void)u32Step;
+
+    if(u32Argc != 2u)
+    {
+        SHELL_vidPrint("usage: resume <prio>\r\n");
+        return FALSE;
+    }
+
+    if(SHELL_u32GetTask(apcArgv[1], &Local_sInfo))
+    {
+        (void)OS_enResumeTask(Local_sInfo.handle);
+    }
+
+    return FALSE;
+}
+
+/* ------------------------------------------------------------------------- */
+
+uint32_t SHELL_u32CmdTrace(uint32_t u32Argc, char * const apcArgv[], uint32_t u32Step)
+{
+#if OS_USE_TRACE
+    uint8_t Local_au8Bytes[SHELL_TRACE_LINE_BYTES];
+    uint32_t Local_u32Size;
+    uint32_t Local_u32Idx;
+
+    (void)u32Argc;
+    (void)apcArgv;
+
+    Local_u32Size = OS_u32TraceRead(Local_au8Bytes, SHELL_TRACE_LINE_BYTES);
+
+    for(Local_u32Idx = 0; Local_u32Idx < Local_u32Size; Local_u32Idx++)
+    {
+        SHELL_vidPrintHex(Local_au8Bytes[Local_u32Idx], 2);
+    }
+
+    if(Local_u32Size)
+    {
+        SHELL_vidPrint("\r\n");
+    }
+
+    /*  the trace keeps recording while it's dumped, stop after one buffer's worth  */
+    return (Local_u32Size == SHELL_TRACE_LINE_BYTES) && (((u32Step + 1u) * SHELL_TRACE_LINE_BYTES) < OS_TRACE_BUFFER_SIZE);
+#else
+    (void)u32Argc;
+    (void)apcArgv;
+    (void)u32Step;
+
+    SHELL_vidPrint("trace is disabled (CONF_OS_USE_TRACE)\r\n");
+
+    return FALSE;
+#endif /*  OS_USE_TRACE  */
+}
+
+/* ------------------------------------------------------------------------- */
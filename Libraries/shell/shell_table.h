@@ -0,0 +1,51 @@
+/*******************************************************************************
+ * @file    shell_table.h
+ * @brief   Shell command table
+ * @details Generated by Tools/gen_shell_cmds.py from shell_cmds.def, do not edit.
+ *          Perfect hash table, see shell.c
+ ******************************************************************************/
+
+#ifndef SHELL_TABLE_H_
+#define SHELL_TABLE_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "shell/shell.h"
+
+/* ------------------------------------------------------------------------- */
+
+#define SHELL_HASH_SEED             0x00000003u
+#define SHELL_HASH_SHIFT            28u
+#define SHELL_TABLE_SIZE            16u
+
+uint32_t SHELL_u32CmdHelp(uint32_t u32Argc, char * const apcArgv[], uint32_t u32Step);
+uint32_t SHELL_u32CmdLoad(uint32_t u32Argc, char * const apcArgv[], uint32_t u32Step);
+uint32_t SHELL_u32CmdOffset(uint32_t u32Argc, char * const apcArgv[], uint32_t u32Step);
+uint32_t SHELL_u32CmdPeriod(uint32_t u32Argc, char * const apcArgv[], uint32_t u32Step);
+uint32_t SHELL_u32CmdResume(uint32_t u32Argc, char * const apcArgv[], uint32_t u32Step);
+uint32_t SHELL_u32CmdStats(uint32_t u32Argc, char * const apcArgv[], uint32_t u32Step);
+uint32_t SHELL_u32CmdSuspend(uint32_t u32Argc, char * const apcArgv[], uint32_t u32Step);
+uint32_t SHELL_u32CmdTasks(uint32_t u32Argc, char * const apcArgv[], uint32_t u32Step);
+uint32_t SHELL_u32CmdTrace(uint32_t u32Argc, char * const apcArgv[], uint32_t u32Step);
+
+static const SHELL_Command_t SHELL_asCommands [SHELL_TABLE_SIZE] = {
+    [ 0] = {"period", SHELL_u32CmdPeriod, "period <prio> <ticks> : change a task's period"},
+    [ 1] = {NULL, NULL, NULL},
+    [ 2] = {"load", SHELL_u32CmdLoad, "CPU load & scheduler overhead"},
+    [ 3] = {NULL, NULL, NULL},
+    [ 4] = {NULL, NULL, NULL},
+    [ 5] = {"tasks", SHELL_u32CmdTasks, "list tasks"},
+    [ 6] = {NULL, NULL, NULL},
+    [ 7] = {"offset", SHELL_u32CmdOffset, "offset <prio> <ticks> : delay a task's next release"},
+    [ 8] = {"resume", SHELL_u32CmdResume, "resume <prio> : resume a task"},
+    [ 9] = {"stats", SHELL_u32CmdStats, "task execution statistics (cycles)"},
+    [10] = {"help", SHELL_u32CmdHelp, "list commands"},
+    [11] = {"suspend", SHELL_u32CmdSuspend, "suspend <prio> : suspend a task"},
+    [12] = {NULL, NULL, NULL},
+    [13] = {NULL, NULL, NULL},
+    [14] = {"trace", SHELL_u32CmdTrace, "dump the trace buffer (hex)"},
+    [15] = {NULL, NULL, NULL},
+};
+
+#endif /* SHELL_TABLE_H_ */
@@ -0,0 +1,376 @@
+/*******************************************************************************
+ * @file    telemetry.c
+ * @brief   Aggregated binary telemetry
+ * @details Metric aggregation & packet encoding, see telemetry.h
+ *
+ *          Welford's algorithm, with the mean in Q8 fixed point:
+ *          - d1    = x - mean
+ *          - mean += d1 / count
+ *          - m2   += d1 * (x - mean)        (Q16, d1 and x - mean have the same sign)
+ *          - variance = m2 / (count - 1)
+ *
+ *          The division is 32-bit (hardware divider) as long as d1 fits in 32 bits,
+ *          and is rounded to the nearest.
+ * @date    18 Oct. 2026
+ * @author  Mohammad Mohsen
+ ******************************************************************************/
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "utils/utils.h"
+#include "utils/cobs.h"
+#include "utils/crc16.h"
+
+#include "uart/uart_tx.h"
+#include "telemetry/telemetry.h"
+
+/* ------------------------------------------------------------------------- */
+
+/**
+ * @brief Largest encoded metric: ID, count, min, max, mean (64-bit) & standard deviation
+ * */
+#define TLM_METRIC_MAX_BYTES        (1u + 5u + 5u + 5u + 10u + 5u)
+
+/**
+ * @brief Largest packet: type, sequence, update count, metrics & CRC
+ * */
+#define TLM_PACKET_MAX_BYTES        (2u + 5u + (TLM_METRIC_COUNT * TLM_METRIC_MAX_BYTES) + 2u)
+
+#if ((COBS_MAX_ENCODED_SIZE(TLM_PACKET_MAX_BYTES) + 1u) > (UART_TX_BUFFER_SIZE / 2u))
+#error "TLM_METRIC_COUNT metrics packet doesn't fit in half of UART_TX_BUFFER_SIZE, lower CONF_TLM_METRIC_COUNT or raise CONF_UART_TX_BUFFER_SIZE"
+#endif
+
+/**
+ * @brief Metric's aggregation state
+ * */
+typedef struct tlm_metric_state_t {
+    int64_t     mean;               /**<  Mean, Q8  */
+    uint64_t    m2;                 /**<  Sum of squared differences from the mean, Q16  */
+    uint32_t    count;              /**<  Number of samples  */
+    int32_t     min;                /**<  Minimum sample  */
+    int32_t     max;                /**<  Maximum sample  */
+    uint32_t    window;             /**<  Window length, in updates  */
+    uint32_t    elapsed;            /**<  Updates since the window started  */
+    uint8_t     id;                 /**<  Metric ID  */
+} TLM_MetricState_t;
+
+/* ------------------------------------------------------------------------- */
+
+/**
+ * Registered metrics
+ * */
+static TLM_MetricState_t TLM_asMetrics [TLM_METRIC_COUNT];
+
+/**
+ * Number of registered metrics
+ * */
+static uint32_t TLM_u32MetricCount;
+
+/**
+ * TLM_vidUpdate() calls
+ * */
+static uint32_t TLM_u32Updates;
+
+/**
+ * Packet sequence number
+ * */
+static uint8_t TLM_u8Sequence;
+
+/**
+ * Packet being built, before COBS encoding
+ * */
+static uint8_t TLM_au8Packet [TLM_PACKET_MAX_BYTES];
+
+/**
+ * Statistics
+ * */
+static TLM_Stats_t TLM_sStats;
+
+/* ------------------------------------------------------------------------- */
+
+/**
+ * @brief Encode a value as LEB128, return the number of bytes
+ * */
+static uint32_t TLM_u32Leb128(uint8_t * pu8Buffer, uint64_t u64Value)
+{
+    uint32_t Local_u32Size = 0;
+
+    while(u64Value >= 0x80u)
+    {
+        pu8Buffer[Local_u32Size++] = (uint8_t)(u64Value | 0x80u);
+        u64Value >>= 7;
+    }
+
+    pu8Buffer[Local_u32Size++] = (uint8_t)u64Value;
+
+    return Local_u32Size;
+}
+
+/**
+ * @brief Encode a signed value as zigzag LEB128, return the number of bytes
+ * */
+static uint32_t TLM_u32Zigzag(uint8_t * pu8Buffer, int64_t s64Value)
+{
+    return TLM_u32Leb128(pu8Buffer, ((uint64_t)s64Value << 1) ^ (uint64_t)(s64Value >> 63));
+}
+
+/**
+ * @brief Integer square root
+ * */
+static uint32_t TLM_u32Sqrt(uint64_t u64Value)
+{
+    uint64_t Local_u64Root = 0;
+    uint64_t Local_u64Bit = (uint64_t)1u << 62;
+
+    while(Local_u64Bit > u64Value)
+    {
+        Local_u64Bit >>= 2;
+    }
+
+    while(Local_u64Bit)
+    {
+        if(u64Value >= (Local_u64Root + Local_u64Bit))
+        {
+            u64Value       -= Local_u64Root + Local_u64Bit;
+            Local_u64Root   = (Local_u64Root >> 1) + Local_u64Bit;
+        }
+        else
+        {
+            Local_u64Root >>= 1;
+        }
+
+        Local_u64Bit >>= 2;
+    }
+
+    return (uint32_t)Local_u64Root;
+}
+
+/**
+ * @brief Append a metric's aggregates to the packet, return the number of bytes
+ * */
+static uint32_t TLM_u32EncodeMetric(uint8_t * pu8Buffer, const TLM_MetricState_t * psMetric)
+{
+    uint32_t Local_u32Size = 0;
+    uint64_t Local_u64Variance = 0;
+
+    if(psMetric->count > 1u)
+    {
+        Local_u64Variance = psMetric->m2 / (psMetric->count - 1u);
+    }
+
+    pu8Buffer[Local_u32Size++] = psMetric->id;
+    Local_u32Size += TLM_u32Leb128(&pu8Buffer[Local_u32Size], psMetric->count);
+    Local_u32Size += TLM_u32Zigzag(&pu8Buffer[Local_u32Size], psMetric->min);
+    Local_u32Size += TLM_u32Zigzag(&pu8Buffer[Local_u32Size], psMetric->max);
+    Local_u32Size += TLM_u32Zigzag(&pu8Buffer[Local_u32Size], psMetric->mean);
+    Local_u32Size += TLM_u32Leb128(&pu8Buffer[Local_u32Size], TLM_u32Sqrt(Local_u64Variance));
+
+    return Local_u32Size;
+}
+
+/* ------------------------------------------------------------------------- */
+
+void TLM_vidInitialize(void)
+{
+    memset(TLM_asMetrics, 0x00, sizeof(TLM_asMetrics));
+    memset(&TLM_sStats, 0x00, sizeof(TLM_sStats));
+
+    TLM_u32MetricCount  = 0;
+    TLM_u32Updates      = 0;
+    TLM_u8Sequence      = 0;
+}
+
+/* ------------------------------------------------------------------------- */
+
+TLM_Error_t TLM_enRegister(uint8_t u8Id, uint32_t u32Window, TLM_Metric_t * pxMetric)
+{
+    uint32_t Local_u32Idx;
+
+    if(IS_NULLPTR(pxMetric))
+    {
+        return TLM_ERROR_NULLPTR;
+    }
+
+    if(IS_ZERO(u32Window))
+    {
+        return TLM_ERROR_INVALID_PARAM;
+    }
+
+    for(Local_u32Idx = 0; Local_u32Idx < TLM_u32MetricCount; Local_u32Idx++)
+    {
+        if(TLM_asMetrics[Local_u32Idx].id == u8Id)
+        {
+            return TLM_ERROR_INVALID_PARAM;
+        }
+    }
+
+    if(TLM_u32MetricCount >= TLM_METRIC_COUNT)
+    {
+        return TLM_ERROR_FULL;
+    }
+
+    memset(&TLM_asMetrics[TLM_u32MetricCount], 0x00, sizeof(TLM_MetricState_t));
+    TLM_asMetrics[TLM_u32MetricCount].id        = u8Id;
+    TLM_asMetrics[TLM_u32MetricCount].window    = u32Window;
+
+    (*pxMetric) = TLM_u32MetricCount++;
+
+    return TLM_ERROR_NONE;
+}
+
+/* ------------------------------------------------------------------------- */
+
+void TLM_vidSample(TLM_Metric_t xMetric, int32_t s32Value)
+{
+    TLM_MetricState_t * Local_psMetric;
+    int64_t Local_s64Value = (int64_t)s32Value * 256;
+    int64_t Local_s64Delta;
+    uint64_t Local_u64Delta1;
+    uint64_t Local_u64Delta2;
+    uint64_t Local_u64Product;
+    uint32_t Local_u32Count;
+
+    if(xMetric >= TLM_u32MetricCount)
+    {
+        return;
+    }
+
+    Local_psMetric = &TLM_asMetrics[xMetric];
+    Local_u32Count = ++Local_psMetric->count;
+
+    if(Local_u32Count == 1u)
+    {
+        Local_psMetric->min     = s32Value;
+        Local_psMetric->max     = s32Value;
+        Local_psMetric->mean    = Local_s64Value;
+        Local_psMetric->m2      = 0;
+        return;
+    }
+
+    if(s32Value < Local_psMetric->min)
+    {
+        Local_psMetric->min = s32Value;
+    }
+
+    if(s32Value > Local_psMetric->max)
+    {
+        Local_psMetric->max = s32Value;
+    }
+
+    Local_s64Delta  = Local_s64Value - Local_psMetric->mean;
+    Local_u64Delta1 = (Local_s64Delta < 0) ? (uint64_t)-Local_s64Delta : (uint64_t)Local_s64Delta;
+
+    /*  rounded division of |d1|, so the mean doesn't drift towards 0  */
+    if(Local_u64Delta1 <= (UINT32_MAX - (Local_u32Count / 2u)))
+    {
+        Local_u64Product = ((uint32_t)Local_u64Delta1 + (Local_u32Count / 2u)) / Local_u32Count;
+    }
+    else
+    {
+        Local_u64Product = (Local_u64Delta1 + (Local_u32Count / 2u)) / Local_u32Count;
+    }
+
+    Local_psMetric->mean += (Local_s64Delta < 0) ? -(int64_t)Local_u64Product : (int64_t)Local_u64Product;
+
+    Local_s64Delta  = Local_s64Value - Local_psMetric->mean;
+    Local_u64Delta2 = (Local_s64Delta < 0) ? (uint64_t)-Local_s64Delta : (uint64_t)Local_s64Delta;
+
+    /*  saturate when the product doesn't fit in 64 bits  */
+    if((Local_u64Delta1 | Local_u64Delta2) >> 32)
+    {
+        Local_psMetric->m2 = UINT64_MAX;
+        return;
+    }
+
+    Local_u64Product = Local_u64Delta1 * Local_u64Delta2;
+
+    if((Local_psMetric->m2 + Local_u64Product) < Local_psMetric->m2)
+    {
+        Local_psMetric->m2 = UINT64_MAX;
+    }
+    else
+    {
+        Local_psMetric->m2 += Local_u64Product;
+    }
+}
+
+/* ------------------------------------------------------------------------- */
+
+void TLM_vidUpdate(void)
+{
+    uint8_t * Local_pu8Buffer;
+    uint32_t Local_u32Size = 0;
+    uint32_t Local_u32Header;
+    uint32_t Local_u32Idx;
+    uint16_t Local_u16Crc;
+
+    TLM_u32Updates++;
+
+    TLM_au8Packet[Local_u32Size++] = TLM_PACKET_TYPE;
+    TLM_au8Packet[Local_u32Size++] = TLM_u8Sequence;
+    Local_u32Size += TLM_u32Leb128(&TLM_au8Packet[Local_u32Size], TLM_u32Updates);
+    Local_u32Header = Local_u32Size;
+
+    for(Local_u32Idx = 0; Local_u32Idx < TLM_u32MetricCount; Local_u32Idx++)
+    {
+        TLM_MetricState_t * Local_psMetric = &TLM_asMetrics[Local_u32Idx];
+
+        if(++Local_psMetric->elapsed < Local_psMetric->window)
+        {
+            continue;
+        }
+
+        Local_psMetric->elapsed = 0;
+
+        /*  empty windows are not sent  */
+        if(Local_psMetric->count)
+        {
+            Local_u32Size += TLM_u32EncodeMetric(&TLM_au8Packet[Local_u32Size], Local_psMetric);
+            Local_psMetric->count = 0;
+        }
+    }
+
+    if(Local_u32Size == Local_u32Header)
+    {
+        return;
+    }
+
+    Local_u16Crc = CRC16_u16Update(CRC16_INIT, TLM_au8Packet, Local_u32Size);
+    TLM_au8Packet[Local_u32Size++] = (uint8_t)Local_u16Crc;
+    TLM_au8Packet[Local_u32Size++] = (uint8_t)(Local_u16Crc >> 8);
+
+    /*  sequence number is incremented for dropped packets too, so the host sees the gap  */
+    TLM_u8Sequence++;
+
+    Local_pu8Buffer = UART_pu8TxReserve(COBS_MAX_ENCODED_SIZE(Local_u32Size) + 1u);
+
+    if(IS_NULLPTR(Local_pu8Buffer))
+    {
+        TLM_sStats.dropped++;
+        return;
+    }
+
+    Local_u32Size = COBS_u32Encode(TLM_au8Packet, Local_u32Size, Local_pu8Buffer);
+    Local_pu8Buffer[Local_u32Size++] = 0;
+
+    UART_vidTxCommit(Local_u32Size);
+
+    TLM_sStats.packets++;
+    TLM_sStats.bytes += Local_u32Size;
+}
+
+/* ------------------------------------------------------------------------- */
+
+void TLM_vidGetStats(TLM_Stats_t * psStats)
+{
+    if(IS_NULLPTR(psStats))
+    {
+        return;
+    }
+
+    *psStats = TLM_sStats;
+}
+
+/* ------------------------------------------------------------------------- */
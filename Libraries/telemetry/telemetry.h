@@ -0,0 +1,149 @@
+/*******************************************************************************
+ * @file    telemetry.h
+ * @brief   Aggregated binary telemetry
+ * @details Registered metrics are sampled by tasks and aggregated on the device,
+ *          over a window of TLM_vidUpdate() calls configured per metric:
+ *          count, min, max, mean & standard deviation (fixed-point Welford).
+ *          Only aggregates are sent, once per window.
+ *
+ *          @code
+ *          TLM_enRegister(TLM_ID_LOAD, 10, &load_metric);     // 10 updates window
+ *
+ *          TLM_vidSample(load_metric, load_permille);          // from any task
+ *          TLM_vidUpdate();                                    // from a periodic task
+ *          @endcode
+ *
+ *          Aggregates of the windows ending at the same update are sent as a single
+ *          packet through the USART1 transmit channel (uart_tx.h):
+ *          - type (1 byte, #TLM_PACKET_TYPE), sequence number (1 byte)
+ *          - update count, LEB128
+ *          - for each metric: ID (1 byte), count (LEB128), min, max (zigzag LEB128),
+ *            mean (Q8, zigzag LEB128), standard deviation (Q8, LEB128)
+ *          - CRC-16/CCITT-FALSE of the above, little endian
+ *
+ *          Packets are COBS encoded and delimited by a zero byte.
+ *          Tools/tlm_decode.py decodes them on the host.
+ *
+ *          Samples must be taken from tasks (not interrupts), in the same context as
+ *          TLM_vidUpdate(). Standard deviation is exact as long as samples are within
+ *          2 ^ 24 of the mean.
+ *
+ *          A packet is reserved in one piece from the transmit channel, which only
+ *          guarantees half of #UART_TX_BUFFER_SIZE, so the largest encoded packet
+ *          (9 bytes, plus 31 bytes per metric, COBS overhead and delimiter) must fit in it.
+ *          This is checked at compile time: 7 metrics with the default 512 bytes buffer,
+ *          16 metrics need a 1024 bytes buffer.
+ *
+ *          Configuration (board_config.h):
+ *          - CONF_TLM_METRIC_COUNT : maximum number of metrics (default 7), see above
+ * @date    18 Oct. 2026
+ * @author  Mohammad Mohsen
+ ******************************************************************************/
+
+#ifndef TELEMETRY_H_
+#define TELEMETRY_H_
+
+#include <stdint.h>
+
+#include "board_config.h"
+
+/* ------------------------------------------------------------------------- */
+
+/**
+ * @addtogroup  telemetry Telemetry
+ * @{
+ * */
+
+/*  COBS_MAX_ENCODED_SIZE(9 + 31 * TLM_METRIC_COUNT) + 1 <= UART_TX_BUFFER_SIZE / 2, see telemetry.c  */
+#ifdef CONF_TLM_METRIC_COUNT
+#define TLM_METRIC_COUNT            CONF_TLM_METRIC_COUNT
+#else
+#define TLM_METRIC_COUNT            7u
+#endif  /*  CONF_TLM_METRIC_COUNT  */
+
+/**
+ * @brief Packet type byte
+ * */
+#define TLM_PACKET_TYPE             0x54u
+
+/**
+ * @brief Error codes
+ * */
+typedef enum tlm_error_t {
+    TLM_ERROR_NONE              = 0,    /**<  No error  */
+    TLM_ERROR_NULLPTR,                  /**<  NULL pointer argument  */
+    TLM_ERROR_INVALID_PARAM,            /**<  Window is 0, or metric ID is already registered  */
+    TLM_ERROR_FULL,                     /**<  #TLM_METRIC_COUNT metrics are already registered  */
+} TLM_Error_t;
+
+/**
+ * @brief Metric handle
+ * */
+typedef uint32_t TLM_Metric_t;
+
+/**
+ * @brief Telemetry statistics
+ * */
+typedef struct tlm_stats_t {
+    uint32_t    packets;            /**<  Packets sent  */
+    uint32_t    bytes;              /**<  Bytes sent, including COBS overhead & delimiters  */
+    uint32_t    dropped;            /**<  Packets dropped, transmit buffer was full  */
+} TLM_Stats_t;
+
+/* ------------------------------------------------------------------------- */
+
+/**
+ * @brief Remove all metrics, and reset statistics
+ *
+ * @param void
+ *
+ * @return void
+ * */
+void TLM_vidInitialize(void);
+
+/**
+ * @brief Register a metric
+ *
+ * @param [in]  u8Id        : metric ID, identifies the metric in packets
+ * @param [in]  u32Window   : aggregation window, number of TLM_vidUpdate() calls
+ * @param [out] pxMetric    : metric handle, used to sample the metric
+ *
+ * @return #TLM_Error_t
+ *              TLM_ERROR_NONE          : Metric was registered
+ *              TLM_ERROR_NULLPTR       : @p pxMetric is NULL
+ *              TLM_ERROR_INVALID_PARAM : @p u32Window is 0, or @p u8Id is already registered
+ *              TLM_ERROR_FULL          : No more metrics can be registered
+ * */
+TLM_Error_t TLM_enRegister(uint8_t u8Id, uint32_t u32Window, TLM_Metric_t * pxMetric);
+
+/**
+ * @brief Add a sample to a metric's current window
+ *
+ * @param [in] xMetric  : metric handle, got from TLM_enRegister()
+ * @param [in] s32Value : sample
+ *
+ * @return void
+ * */
+void TLM_vidSample(TLM_Metric_t xMetric, int32_t s32Value);
+
+/**
+ * @brief Advance metrics' windows, and send aggregates of the windows that ended
+ *
+ * @param void
+ *
+ * @return void
+ * */
+void TLM_vidUpdate(void);
+
+/**
+ * @brief Get telemetry statistics
+ *
+ * @param [out] psStats : pointer to a statistics structure to fill
+ *
+ * @return void
+ * */
+void TLM_vidGetStats(TLM_Stats_t * psStats);
+
+/**@}*/
+
+#endif /* TELEMETRY_H_ */
@@ -0,0 +1,345 @@
+/*******************************************************************************
+ * @file    uart_rx.c
+ * @brief   DMA driven USART1 receive channel with idle line framing
+ * @details Ring buffer, frame queue and interrupt handling, see uart_rx.h
+ *
+ *          Stream positions are free running byte counters (modulo 2 ^ 32), the
+ *          ring buffer index of a position is its value modulo #UART_RX_BUFFER_SIZE:
+ *          - head : end of queued data, only written by the interrupts
+ *          - DMA position : end of received data, (buffer size - CNDTR)
+ *
+ *          Data at position p is valid as long as the DMA position didn't pass
+ *          p + #UART_RX_BUFFER_SIZE. Interrupts at half transfer and transfer complete
+ *          keep head within half a buffer of the DMA position.
+ * @date    18 Oct. 2026
+ * @author  Mohammad Mohsen
+ ******************************************************************************/
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "main.h"
+
+#include "utils/utils.h"
+
+#include "simple_os_port.h"
+
+#include "uart/uart_rx.h"
+
+/*  statistics are read in critical sections, which must mask the channel's interrupts  */
+#if OS_MAX_SYSCALL_PRIORITY && (UART_RX_IRQ_PRIORITY < OS_MAX_SYSCALL_PRIORITY)
+#error "UART_RX_IRQ_PRIORITY must be OS_MAX_SYSCALL_PRIORITY or lower (numerically greater or equal)"
+#endif
+
+#if (UART_RX_BUFFER_SIZE & (UART_RX_BUFFER_SIZE - 1))
+#error "UART_RX_BUFFER_SIZE must be a power of 2"
+#endif
+
+#if (UART_RX_FRAME_COUNT & (UART_RX_FRAME_COUNT - 1))
+#error "UART_RX_FRAME_COUNT must be a power of 2"
+#endif
+
+/* ------------------------------------------------------------------------- */
+
+/**
+ * @brief Queued span of received data
+ * */
+typedef struct uart_rx_span_t {
+    uint32_t    start;              /**<  Stream position of the first byte  */
+    uint32_t    size;               /**<  Number of bytes  */
+    uint32_t    flags;              /**<  UART_RX_FRAME_xxx flags  */
+} UART_RxSpan_t;
+
+/**
+ * @brief Receive channel state
+ * */
+typedef struct uart_rx_state_t {
+    uint32_t    head;               /**<  Stream position of the end of queued data  */
+    uint32_t    frame_write;        /**<  Frame queue write counter, only written by the interrupts  */
+    uint32_t    frame_read;         /**<  Frame queue read counter, only written by the consumer  */
+    uint32_t    flags;              /**<  Flags of the next queued span  */
+    uint32_t    partial;            /**<  Last queued span didn't end a frame  */
+    UART_vidRxCallback_t callback;  /**<  Frame callback  */
+} UART_RxState_t;
+
+/* ------------------------------------------------------------------------- */
+
+/**
+ * Receive ring buffer, written by DMA
+ * */
+static uint8_t UART_au8RxBuffer [UART_RX_BUFFER_SIZE];
+
+/**
+ * Frame queue
+ * */
+static UART_RxSpan_t UART_asRxFrames [UART_RX_FRAME_COUNT];
+
+/**
+ * Receive channel state
+ * */
+static volatile UART_RxState_t UART_sRxState;
+
+/**
+ * Receive statistics
+ * */
+static volatile UART_RxStats_t UART_sRxStats;
+
+/* ------------------------------------------------------------------------- */
+
+/**
+ * @brief Get the DMA position's ring buffer index
+ * */
+static inline uint32_t UART_u32RxDmaIndex(void)
+{
+    /*  CNDTR counts down from the buffer size, and reloads at the buffer end  */
+    return (UART_RX_BUFFER_SIZE - LL_DMA_GetDataLength(DMA1, LL_DMA_CHANNEL_5)) & (UART_RX_BUFFER_SIZE - 1u);
+}
+
+/**
+ * @brief Check if a span's data was not overwritten yet
+ * */
+static uint32_t UART_u32RxSpanValid(const UART_RxSpan_t * psSpan)
+{
+    /*  head first: the DMA position read after it is always ahead of it  */
+    uint32_t Local_u32Head = UART_sRxState.head;
+    uint32_t Local_u32Received = Local_u32Head + ((UART_u32RxDmaIndex() - Local_u32Head) & (UART_RX_BUFFER_SIZE - 1u));
+
+    return ((Local_u32Received - psSpan->start) <= UART_RX_BUFFER_SIZE);
+}
+
+/**
+ * @brief Queue data received since the last span (interrupt context)
+ *
+ * @param [in] u32Flags : #UART_RX_FRAME_END at idle line, 0 at DMA half / full buffer
+ * */
+static void UART_vidRxQueue(uint32_t u32Flags)
+{
+    uint32_t Local_u32Head  = UART_sRxState.head;
+    uint32_t Local_u32Write = UART_sRxState.frame_write;
+    uint32_t Local_u32Size  = (UART_u32RxDmaIndex() - Local_u32Head) & (UART_RX_BUFFER_SIZE - 1u);
+    UART_RxSpan_t * Local_psSpan;
+
+    /*  an empty span is only queued to end a frame that was handed over in chunks  */
+    if(IS_ZERO(Local_u32Size) && !((u32Flags & UART_RX_FRAME_END) && UART_sRxState.partial))
+    {
+        return;
+    }
+
+    UART_sRxState.head      = Local_u32Head + Local_u32Size;
+    UART_sRxState.partial   = !(u32Flags & UART_RX_FRAME_END);
+
+    UART_sRxStats.bytes += Local_u32Size;
+
+    if(u32Flags & UART_RX_FRAME_END)
+    {
+        UART_sRxStats.frames++;
+    }
+
+    if((Local_u32Write - UART_sRxState.frame_read) >= UART_RX_FRAME_COUNT)
+    {
+        UART_sRxStats.dropped++;
+        UART_sRxState.flags = UART_RX_FRAME_LOST;
+        return;
+    }
+
+    Local_psSpan = &UART_asRxFrames[Local_u32Write & (UART_RX_FRAME_COUNT - 1u)];
+    Local_psSpan->start = Local_u32Head;
+    Local_psSpan->size  = Local_u32Size;
+    Local_psSpan->flags = u32Flags | UART_sRxState.flags;
+
+    UART_sRxState.flags = 0;
+
+    /*  publish the span after it is written  */
+    __DMB();
+    UART_sRxState.frame_write = Local_u32Write + 1u;
+
+    if(!IS_NULLPTR(UART_sRxState.callback))
+    {
+        UART_sRxState.callback();
+    }
+}
+
+/* ------------------------------------------------------------------------- */
+
+void UART_vidRxInit(uint32_t u32Baudrate, UART_vidRxCallback_t pfCallback)
+{
+    LL_GPIO_InitTypeDef GPIO_InitStruct = {0};
+    LL_USART_InitTypeDef USART_InitStruct = {0};
+
+    UART_vidRxDeinit();
+
+    UART_sRxState.callback = pfCallback;
+
+    LL_APB2_GRP1_EnableClock(LL_APB2_GRP1_PERIPH_USART1);
+    LL_APB2_GRP1_EnableClock(LL_APB2_GRP1_PERIPH_GPIOA);
+    LL_AHB1_GRP1_EnableClock(LL_AHB1_GRP1_PERIPH_DMA1);
+
+    /*  USART1 RX: PA10, pulled up so a disconnected line stays idle  */
+    GPIO_InitStruct.Pin         = LL_GPIO_PIN_10;
+    GPIO_InitStruct.Mode        = LL_GPIO_MODE_INPUT;
+    GPIO_InitStruct.Pull        = LL_GPIO_PULL_UP;
+    LL_GPIO_Init(GPIOA, &GPIO_InitStruct);
+
+    /*  keep the transmitter if it was enabled by uart_tx.h  */
+    LL_USART_Disable(USART1);
+    LL_USART_StructInit(&USART_InitStruct);
+    USART_InitStruct.BaudRate           = u32Baudrate;
+    USART_InitStruct.TransferDirection  = LL_USART_DIRECTION_RX | (LL_USART_GetTransferDirection(USART1) & LL_USART_DIRECTION_TX);
+    LL_USART_Init(USART1, &USART_InitStruct);
+    LL_USART_ConfigAsyncMode(USART1);
+    LL_USART_EnableDMAReq_RX(USART1);
+
+    /*  DMA1 channel 5: USART1 data register to the ring buffer, one byte per request  */
+    LL_DMA_ConfigTransfer(DMA1, LL_DMA_CHANNEL_5,
+            LL_DMA_DIRECTION_PERIPH_TO_MEMORY |
+            LL_DMA_PRIORITY_HIGH |
+            LL_DMA_MODE_CIRCULAR |
+            LL_DMA_PERIPH_NOINCREMENT |
+            LL_DMA_MEMORY_INCREMENT |
+            LL_DMA_PDATAALIGN_BYTE |
+            LL_DMA_MDATAALIGN_BYTE);
+    LL_DMA_SetPeriphAddress(DMA1, LL_DMA_CHANNEL_5, LL_USART_DMA_GetRegAddr(USART1));
+    LL_DMA_SetMemoryAddress(DMA1, LL_DMA_CHANNEL_5, (uint32_t)UART_au8RxBuffer);
+    LL_DMA_SetDataLength(DMA1, LL_DMA_CHANNEL_5, UART_RX_BUFFER_SIZE);
+    LL_DMA_EnableIT_HT(DMA1, LL_DMA_CHANNEL_5);
+    LL_DMA_EnableIT_TC(DMA1, LL_DMA_CHANNEL_5);
+    LL_DMA_EnableChannel(DMA1, LL_DMA_CHANNEL_5);
+
+    LL_USART_EnableIT_IDLE(USART1);
+    LL_USART_Enable(USART1);
+
+    NVIC_SetPriority(USART1_IRQn, NVIC_EncodePriority(NVIC_GetPriorityGrouping(), UART_RX_IRQ_PRIORITY, 0));
+    NVIC_SetPriority(DMA1_Channel5_IRQn, NVIC_EncodePriority(NVIC_GetPriorityGrouping(), UART_RX_IRQ_PRIORITY, 0));
+    NVIC_ClearPendingIRQ(USART1_IRQn);
+    NVIC_ClearPendingIRQ(DMA1_Channel5_IRQn);
+    NVIC_EnableIRQ(USART1_IRQn);
+    NVIC_EnableIRQ(DMA1_Channel5_IRQn);
+}
+
+/* ------------------------------------------------------------------------- */
+
+void UART_vidRxDeinit(void)
+{
+    NVIC_DisableIRQ(USART1_IRQn);
+    NVIC_DisableIRQ(DMA1_Channel5_IRQn);
+
+    if(LL_AHB1_GRP1_IsEnabledClock(LL_AHB1_GRP1_PERIPH_DMA1))
+    {
+        LL_DMA_DisableChannel(DMA1, LL_DMA_CHANNEL_5);
+        LL_DMA_ClearFlag_GI5(DMA1);
+    }
+
+    if(LL_APB2_GRP1_IsEnabledClock(LL_APB2_GRP1_PERIPH_USART1))
+    {
+        LL_USART_DisableIT_IDLE(USART1);
+        LL_USART_DisableDMAReq_RX(USART1);
+        LL_USART_DisableDirectionRx(USART1);
+    }
+
+    memset((void *)&UART_sRxState, 0x00, sizeof(UART_RxState_t));
+    memset((void *)&UART_sRxStats, 0x00, sizeof(UART_RxStats_t));
+}
+
+/* ------------------------------------------------------------------------- */
+
+uint32_t UART_u32RxGetFrame(UART_RxFrame_t * psFrame)
+{
+    uint32_t Local_u32Read = UART_sRxState.frame_read;
+    const UART_RxSpan_t * Local_psSpan;
+    uint32_t Local_u32Index;
+
+    if(IS_NULLPTR(psFrame) || (Local_u32Read == UART_sRxState.frame_write))
+    {
+        return 0;
+    }
+
+    /*  span is read after the write counter  */
+    __DMB();
+
+    Local_psSpan    = &UART_asRxFrames[Local_u32Read & (UART_RX_FRAME_COUNT - 1u)];
+    Local_u32Index  = Local_psSpan->start & (UART_RX_BUFFER_SIZE - 1u);
+
+    psFrame->pu8Data[0] = &UART_au8RxBuffer[Local_u32Index];
+    psFrame->u32Size[0] = MIN(Local_psSpan->size, UART_RX_BUFFER_SIZE - Local_u32Index);
+    psFrame->pu8Data[1] = UART_au8RxBuffer;
+    psFrame->u32Size[1] = Local_psSpan->size - psFrame->u32Size[0];
+    psFrame->u32Flags   = Local_psSpan->flags;
+
+    if(!UART_u32RxSpanValid(Local_psSpan))
+    {
+        psFrame->u32Flags |= UART_RX_FRAME_OVERRUN;
+    }
+
+    return 1;
+}
+
+/* ------------------------------------------------------------------------- */
+
+uint32_t UART_u32RxReleaseFrame(void)
+{
+    uint32_t Local_u32Read = UART_sRxState.frame_read;
+    uint32_t Local_u32Valid;
+
+    if(Local_u32Read == UART_sRxState.frame_write)
+    {
+        return 0;
+    }
+
+    Local_u32Valid = UART_u32RxSpanValid(&UART_asRxFrames[Local_u32Read & (UART_RX_FRAME_COUNT - 1u)]);
+
+    /*  span is free only after it is read  */
+    __DMB();
+    UART_sRxState.frame_read = Local_u32Read + 1u;
+
+    return Local_u32Valid;
+}
+
+/* ------------------------------------------------------------------------- */
+
+void UART_vidRxGetStats(UART_RxStats_t * psStats)
+{
+
+    if(IS_NULLPTR(psStats))
+    {
+        return;
+    }
+
+    /*  statistics are written from the USART & DMA interrupts  */
+    OS_PORT_ENTER_CRITICAL();
+    *psStats = UART_sRxStats;
+    OS_PORT_EXIT_CRITICAL();
+}
+
+/* ------------------------------------------------------------------------- */
+
+void UART_vidRxUsartIrqHandler(void)
+{
+    if(LL_USART_IsActiveFlag_IDLE(USART1) && LL_USART_IsEnabledIT_IDLE(USART1))
+    {
+        if(LL_USART_IsActiveFlag_FE(USART1) || LL_USART_IsActiveFlag_NE(USART1) || LL_USART_IsActiveFlag_ORE(USART1))
+        {
+            UART_sRxStats.errors++;
+        }
+
+        /*  SR then DR read, also clears error flags. The DMA already read the last byte  */
+        LL_USART_ClearFlag_IDLE(USART1);
+
+        UART_vidRxQueue(UART_RX_FRAME_END);
+    }
+}
+
+/* ------------------------------------------------------------------------- */
+
+void UART_vidRxDmaIrqHandler(void)
+{
+    if(LL_DMA_IsActiveFlag_HT5(DMA1) || LL_DMA_IsActiveFlag_TC5(DMA1))
+    {
+        LL_DMA_ClearFlag_HT5(DMA1);
+        LL_DMA_ClearFlag_TC5(DMA1);
+
+        UART_vidRxQueue(0);
+    }
+}
+
+/* ------------------------------------------------------------------------- */
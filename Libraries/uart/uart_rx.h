@@ -0,0 +1,198 @@
+/*******************************************************************************
+ * @file    uart_rx.h
+ * @brief   DMA driven USART1 receive channel with idle line framing
+ * @details USART1 reception (PA10) through DMA1 channel 5 in circular mode.
+ *
+ *          The DMA writes received bytes into a ring buffer without any CPU
+ *          intervention. Received data is split in spans at:
+ *          - USART idle line (end of a frame)
+ *          - DMA half transfer & transfer complete (ring buffer half / end), so long
+ *            frames are handed over in chunks before they are overwritten
+ *
+ *          Each span is queued as a frame descriptor, and handed to the consumer as up
+ *          to two (pointer, length) views into the ring buffer (two when the span wraps
+ *          around the buffer end), data is never copied.
+ *
+ *          @code
+ *          UART_RxFrame_t frame;
+ *
+ *          while(UART_u32RxGetFrame(&frame))
+ *          {
+ *              parse(frame.pu8Data[0], frame.u32Size[0]);
+ *              parse(frame.pu8Data[1], frame.u32Size[1]);
+ *
+ *              if(frame.u32Flags & UART_RX_FRAME_END)
+ *              {
+ *                  parse_end();
+ *              }
+ *
+ *              UART_u32RxReleaseFrame();
+ *          }
+ *          @endcode
+ *
+ *          A callback is called from interrupt context every time a frame descriptor is
+ *          queued, to wake up the consumer, e.g. using OS_enReadyTask() on an event task.
+ *
+ *          The DMA never stops, so frames must be released before #UART_RX_BUFFER_SIZE more
+ *          bytes are received, otherwise their data is overwritten (flagged by
+ *          #UART_RX_FRAME_OVERRUN, and by UART_u32RxReleaseFrame()).
+ *
+ *          UART_vidRxUsartIrqHandler() must be called from USART1_IRQHandler(), and
+ *          UART_vidRxDmaIrqHandler() from DMA1_Channel5_IRQHandler(). Both interrupts
+ *          share the same priority, so they never preempt each other. stm32f1xx_it.c only
+ *          provides both handlers when CONF_UART_USE_RX_DMA is 1, so that firmware not using
+ *          the channel doesn't link it (and its buffer) through the vector table.
+ *
+ *          USART1 is shared with uart_tx.h, both must be initialized with the same baud rate.
+ *
+ *          Configuration (board_config.h):
+ *          - CONF_UART_USE_RX_DMA : provide USART1_IRQHandler() & DMA1_Channel5_IRQHandler() (default 0)
+ *          - CONF_UART_RX_BUFFER_SIZE : ring buffer size in bytes, power of 2 (default 256)
+ *          - CONF_UART_RX_FRAME_COUNT : frame descriptor queue size, power of 2 (default 8)
+ *          - CONF_UART_RX_IRQ_PRIORITY : USART & DMA interrupts priority (default 14)
+ * @date    18 Oct. 2026
+ * @author  Mohammad Mohsen
+ ******************************************************************************/
+
+#ifndef UART_RX_H_
+#define UART_RX_H_
+
+#include <stdint.h>
+
+#include "board_config.h"
+
+/* ------------------------------------------------------------------------- */
+
+/**
+ * @addtogroup  uart_rx UART DMA receive channel
+ * @{
+ * */
+
+#ifdef CONF_UART_USE_RX_DMA
+#define UART_USE_RX_DMA             CONF_UART_USE_RX_DMA
+#else
+#define UART_USE_RX_DMA             0
+#endif  /*  CONF_UART_USE_RX_DMA  */
+
+#ifdef CONF_UART_RX_BUFFER_SIZE
+#define UART_RX_BUFFER_SIZE         CONF_UART_RX_BUFFER_SIZE
+#else
+#define UART_RX_BUFFER_SIZE         256u
+#endif  /*  CONF_UART_RX_BUFFER_SIZE  */
+
+#ifdef CONF_UART_RX_FRAME_COUNT
+#define UART_RX_FRAME_COUNT         CONF_UART_RX_FRAME_COUNT
+#else
+#define UART_RX_FRAME_COUNT         8u
+#endif  /*  CONF_UART_RX_FRAME_COUNT  */
+
+#ifdef CONF_UART_RX_IRQ_PRIORITY
+#define UART_RX_IRQ_PRIORITY        CONF_UART_RX_IRQ_PRIORITY
+#else
+#define UART_RX_IRQ_PRIORITY        14u
+#endif  /*  CONF_UART_RX_IRQ_PRIORITY  */
+
+/**
+ * @brief Frame flags
+ * */
+#define UART_RX_FRAME_END           0x01u   /**<  Span ends a frame (idle line), otherwise the frame continues in the next span  */
+#define UART_RX_FRAME_LOST          0x02u   /**<  Data received before this span was lost (frame queue was full)  */
+#define UART_RX_FRAME_OVERRUN       0x04u   /**<  Span's data was overwritten by newer data  */
+
+/**
+ * @brief Received frame (span), a view into the ring buffer
+ * */
+typedef struct uart_rx_frame_t {
+    const uint8_t * pu8Data[2];     /**<  Data, second part is used when the span wraps around the buffer end  */
+    uint32_t        u32Size[2];     /**<  Size of each part, second part size is 0 if the span doesn't wrap  */
+    uint32_t        u32Flags;       /**<  UART_RX_FRAME_xxx flags  */
+} UART_RxFrame_t;
+
+/**
+ * @brief Receive statistics
+ * */
+typedef struct uart_rx_stats_t {
+    uint32_t    bytes;              /**<  Bytes received  */
+    uint32_t    frames;             /**<  Frames (idle lines) received  */
+    uint32_t    dropped;            /**<  Spans dropped, frame queue was full  */
+    uint32_t    errors;             /**<  Idle lines with framing, noise or overrun errors  */
+} UART_RxStats_t;
+
+/**
+ * @brief Frame callback, called from interrupt context when a frame (span) is queued
+ *
+ * @param void
+ *
+ * @return void
+ * */
+typedef void (*UART_vidRxCallback_t)(void);
+
+/* ------------------------------------------------------------------------- */
+
+/**
+ * @brief Initialize USART1 receiver (8N1), its DMA channel & interrupts, discards received data
+ *
+ * @param [in] u32Baudrate : baud rate, at most PCLK2 / 16
+ * @param [in] pfCallback  : frame callback, can be NULL
+ *
+ * @return void
+ * */
+void UART_vidRxInit(uint32_t u32Baudrate, UART_vidRxCallback_t pfCallback);
+
+/**
+ * @brief Stop the DMA channel, disable USART1 receiver & its interrupts
+ *
+ * @param void
+ *
+ * @return void
+ * */
+void UART_vidRxDeinit(void);
+
+/**
+ * @brief Get the oldest received frame (span), the frame is kept until UART_u32RxReleaseFrame()
+ *
+ * @param [out] psFrame : pointer to a frame structure to fill
+ *
+ * @return 1 if a frame was got, 0 if no frame is available
+ * */
+uint32_t UART_u32RxGetFrame(UART_RxFrame_t * psFrame);
+
+/**
+ * @brief Release the oldest frame, got by UART_u32RxGetFrame()
+ *
+ * @param void
+ *
+ * @return 1 if the frame's data was still valid when released, 0 if it was overwritten (or no frame)
+ * */
+uint32_t UART_u32RxReleaseFrame(void);
+
+/**
+ * @brief Get receive statistics
+ *
+ * @param [out] psStats : pointer to a statistics structure to fill
+ *
+ * @return void
+ * */
+void UART_vidRxGetStats(UART_RxStats_t * psStats);
+
+/**
+ * @brief USART1 interrupt handler (idle line), call from USART1_IRQHandler()
+ *
+ * @param void
+ *
+ * @return void
+ * */
+void UART_vidRxUsartIrqHandler(void);
+
+/**
+ * @brief DMA1 channel 5 interrupt handler, call from DMA1_Channel5_IRQHandler()
+ *
+ * @param void
+ *
+ * @return void
+ * */
+void UART_vidRxDmaIrqHandler(void);
+
+/**@}*/
+
+#endif /* UART_RX_H_ */
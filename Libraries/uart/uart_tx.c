@@ -0,0 +1,351 @@
+/*******************************************************************************
+ * @file    uart_tx.c
+ * @brief   DMA driven USART1 transmit channel
+ * @details Bipartite ring buffer and DMA handling, see uart_tx.h
+ *
+ *          Ring buffer indices:
+ *          - write : end of committed data, only written by producers
+ *          - read  : start of data not sent yet, only written by the DMA interrupt
+ *          - last  : end of valid data when write has wrapped around before read,
+ *                    bytes between last and the buffer end are skipped
+ * @date    18 Oct. 2026
+ * @author  Mohammad Mohsen
+ ******************************************************************************/
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "main.h"
+
+#include "utils/utils.h"
+
+#include "simple_os_port.h"
+
+#include "uart/uart_tx.h"
+
+/*  statistics are read in critical sections, which must mask the channel's interrupts  */
+#if OS_MAX_SYSCALL_PRIORITY && (UART_TX_IRQ_PRIORITY < OS_MAX_SYSCALL_PRIORITY)
+#error "UART_TX_IRQ_PRIORITY must be OS_MAX_SYSCALL_PRIORITY or lower (numerically greater or equal)"
+#endif
+
+#if (UART_TX_BUFFER_SIZE & (UART_TX_BUFFER_SIZE - 1))
+#error "UART_TX_BUFFER_SIZE must be a power of 2"
+#endif
+
+/* ------------------------------------------------------------------------- */
+
+/**
+ * @brief Transmit channel state
+ * */
+typedef struct uart_tx_state_t {
+    uint32_t    write;              /**<  End of committed data  */
+    uint32_t    read;               /**<  Start of pending data  */
+    uint32_t    last;               /**<  End of valid data, when write < read  */
+    uint32_t    reserve_start;      /**<  Start of the current reservation  */
+    uint32_t    reserve_size;       /**<  Size of the current reservation  */
+    uint32_t    dma_size;           /**<  Size of the running DMA transfer, 0 if idle  */
+} UART_TxState_t;
+
+/* ------------------------------------------------------------------------- */
+
+/**
+ * Transmit buffer
+ * */
+static uint8_t UART_au8TxBuffer [UART_TX_BUFFER_SIZE];
+
+/**
+ * Transmit channel state
+ * */
+static volatile UART_TxState_t UART_sTxState;
+
+/**
+ * Transmit statistics
+ * */
+static volatile UART_TxStats_t UART_sTxStats;
+
+/* ------------------------------------------------------------------------- */
+
+/**
+ * @brief Start a DMA transfer of the next contiguous region, if any (DMA interrupt context)
+ * */
+static void UART_vidTxStart(void)
+{
+    uint32_t Local_u32Write = UART_sTxState.write;
+    uint32_t Local_u32Read  = UART_sTxState.read;
+    uint32_t Local_u32Size;
+
+    /*  writer wrapped around, and all data up to the last valid byte was sent  */
+    if((Local_u32Read == UART_sTxState.last) && (Local_u32Write < Local_u32Read))
+    {
+        Local_u32Read = 0;
+        UART_sTxState.read = 0;
+    }
+
+    if(Local_u32Write < Local_u32Read)
+    {
+        Local_u32Size = UART_sTxState.last - Local_u32Read;
+    }
+    else
+    {
+        Local_u32Size = Local_u32Write - Local_u32Read;
+    }
+
+    if(IS_ZERO(Local_u32Size))
+    {
+        return;
+    }
+
+    UART_sTxState.dma_size = Local_u32Size;
+
+    LL_DMA_DisableChannel(DMA1, LL_DMA_CHANNEL_4);
+    LL_DMA_SetMemoryAddress(DMA1, LL_DMA_CHANNEL_4, (uint32_t)&UART_au8TxBuffer[Local_u32Read]);
+    LL_DMA_SetDataLength(DMA1, LL_DMA_CHANNEL_4, Local_u32Size);
+    LL_DMA_EnableChannel(DMA1, LL_DMA_CHANNEL_4);
+}
+
+/* ------------------------------------------------------------------------- */
+
+void UART_vidTxInit(uint32_t u32Baudrate)
+{
+    LL_GPIO_InitTypeDef GPIO_InitStruct = {0};
+    LL_USART_InitTypeDef USART_InitStruct = {0};
+
+    UART_vidTxDeinit();
+
+    LL_APB2_GRP1_EnableClock(LL_APB2_GRP1_PERIPH_USART1);
+    LL_APB2_GRP1_EnableClock(LL_APB2_GRP1_PERIPH_GPIOA);
+    LL_AHB1_GRP1_EnableClock(LL_AHB1_GRP1_PERIPH_DMA1);
+
+    /*  USART1 TX: PA9  */
+    GPIO_InitStruct.Pin         = LL_GPIO_PIN_9;
+    GPIO_InitStruct.Mode        = LL_GPIO_MODE_ALTERNATE;
+    GPIO_InitStruct.Speed       = LL_GPIO_SPEED_FREQ_HIGH;
+    GPIO_InitStruct.OutputType  = LL_GPIO_OUTPUT_PUSHPULL;
+    LL_GPIO_Init(GPIOA, &GPIO_InitStruct);
+
+    /*  keep the receiver if it was enabled by uart_rx.h  */
+    LL_USART_Disable(USART1);
+    LL_USART_StructInit(&USART_InitStruct);
+    USART_InitStruct.BaudRate           = u32Baudrate;
+    USART_InitStruct.TransferDirection  = LL_USART_DIRECTION_TX | (LL_USART_GetTransferDirection(USART1) & LL_USART_DIRECTION_RX);
+    LL_USART_Init(USART1, &USART_InitStruct);
+    LL_USART_ConfigAsyncMode(USART1);
+    LL_USART_EnableDMAReq_TX(USART1);
+    LL_USART_Enable(USART1);
+
+    /*  DMA1 channel 4: memory to USART1 data register, one byte per request  */
+    LL_DMA_ConfigTransfer(DMA1, LL_DMA_CHANNEL_4,
+            LL_DMA_DIRECTION_MEMORY_TO_PERIPH |
+            LL_DMA_PRIORITY_LOW |
+            LL_DMA_MODE_NORMAL |
+            LL_DMA_PERIPH_NOINCREMENT |
+            LL_DMA_MEMORY_INCREMENT |
+            LL_DMA_PDATAALIGN_BYTE |
+            LL_DMA_MDATAALIGN_BYTE);
+    LL_DMA_SetPeriphAddress(DMA1, LL_DMA_CHANNEL_4, LL_USART_DMA_GetRegAddr(USART1));
+    LL_DMA_EnableIT_TC(DMA1, LL_DMA_CHANNEL_4);
+    LL_DMA_EnableIT_TE(DMA1, LL_DMA_CHANNEL_4);
+
+    NVIC_SetPriority(DMA1_Channel4_IRQn, NVIC_EncodePriority(NVIC_GetPriorityGrouping(), UART_TX_IRQ_PRIORITY, 0));
+    NVIC_ClearPendingIRQ(DMA1_Channel4_IRQn);
+    NVIC_EnableIRQ(DMA1_Channel4_IRQn);
+}
+
+/* ------------------------------------------------------------------------- */
+
+void UART_vidTxDeinit(void)
+{
+    NVIC_DisableIRQ(DMA1_Channel4_IRQn);
+
+    if(LL_AHB1_GRP1_IsEnabledClock(LL_AHB1_GRP1_PERIPH_DMA1))
+    {
+        LL_DMA_DisableChannel(DMA1, LL_DMA_CHANNEL_4);
+        LL_DMA_ClearFlag_GI4(DMA1);
+    }
+
+    if(LL_APB2_GRP1_IsEnabledClock(LL_APB2_GRP1_PERIPH_USART1))
+    {
+        LL_USART_DisableDMAReq_TX(USART1);
+    }
+
+    memset((void *)&UART_sTxState, 0x00, sizeof(UART_TxState_t));
+    UART_sTxState.last = UART_TX_BUFFER_SIZE;
+
+    memset((void *)&UART_sTxStats, 0x00, sizeof(UART_TxStats_t));
+}
+
+/* ------------------------------------------------------------------------- */
+
+uint8_t * UART_pu8TxReserve(uint32_t u32Size)
+{
+    uint32_t Local_u32Write = UART_sTxState.write;
+    uint32_t Local_u32Read  = UART_sTxState.read;
+    uint32_t Local_u32Start;
+
+    if(IS_ZERO(u32Size) || (u32Size > UART_TX_BUFFER_SIZE))
+    {
+        UART_sTxStats.rejected++;
+        return NULL;
+    }
+
+    if(Local_u32Write < Local_u32Read)
+    {
+        /*  wrapped: free space is [write, read), keep one byte so write never reaches read  */
+        if((Local_u32Write + u32Size) >= Local_u32Read)
+        {
+            UART_sTxStats.rejected++;
+            return NULL;
+        }
+
+        Local_u32Start = Local_u32Write;
+    }
+    else if((Local_u32Write + u32Size) <= UART_TX_BUFFER_SIZE)
+    {
+        Local_u32Start = Local_u32Write;
+    }
+    else if(u32Size < Local_u32Read)
+    {
+        /*  not enough space at the end of the buffer, wrap around  */
+        Local_u32Start = 0;
+    }
+    else
+    {
+        UART_sTxStats.rejected++;
+        return NULL;
+    }
+
+    UART_sTxState.reserve_start = Local_u32Start;
+    UART_sTxState.reserve_size  = u32Size;
+
+    return &UART_au8TxBuffer[Local_u32Start];
+}
+
+/* ------------------------------------------------------------------------- */
+
+void UART_vidTxCommit(uint32_t u32Size)
+{
+    uint32_t Local_u32Write = UART_sTxState.write;
+    uint32_t Local_u32NewWrite;
+
+    if(IS_ZERO(UART_sTxState.reserve_size))
+    {
+        return;
+    }
+
+    u32Size = MIN(u32Size, UART_sTxState.reserve_size);
+    UART_sTxState.reserve_size = 0;
+
+    if(IS_ZERO(u32Size))
+    {
+        return;
+    }
+
+    Local_u32NewWrite = UART_sTxState.reserve_start + u32Size;
+
+    if((Local_u32NewWrite < Local_u32Write) && (Local_u32Write != UART_TX_BUFFER_SIZE))
+    {
+        /*  wrapped around: data ends at the old write index  */
+        UART_sTxState.last = Local_u32Write;
+    }
+    else if(Local_u32NewWrite > UART_sTxState.last)
+    {
+        /*  passed the old end of data, the whole buffer is valid again  */
+        UART_sTxState.last = UART_TX_BUFFER_SIZE;
+    }
+
+    /*  publish data after last is updated  */
+    UART_sTxState.write = Local_u32NewWrite;
+
+    /*  DMA transfers are only started from the DMA interrupt  */
+    if(IS_ZERO(UART_sTxState.dma_size))
+    {
+        NVIC_SetPendingIRQ(DMA1_Channel4_IRQn);
+    }
+}
+
+/* ------------------------------------------------------------------------- */
+
+uint32_t UART_u32TxWrite(const uint8_t * pu8Data, uint32_t u32Size)
+{
+    uint8_t * Local_pu8Buffer;
+
+    if(IS_NULLPTR(pu8Data))
+    {
+        return 0;
+    }
+
+    Local_pu8Buffer = UART_pu8TxReserve(u32Size);
+
+    if(IS_NULLPTR(Local_pu8Buffer))
+    {
+        return 0;
+    }
+
+    memcpy(Local_pu8Buffer, pu8Data, u32Size);
+    UART_vidTxCommit(u32Size);
+
+    return u32Size;
+}
+
+/* ------------------------------------------------------------------------- */
+
+uint32_t UART_u32TxPending(void)
+{
+    uint32_t Local_u32Write = UART_sTxState.write;
+    uint32_t Local_u32Read  = UART_sTxState.read;
+
+    if(Local_u32Write < Local_u32Read)
+    {
+        return (UART_sTxState.last - Local_u32Read) + Local_u32Write;
+    }
+
+    return Local_u32Write - Local_u32Read;
+}
+
+/* ------------------------------------------------------------------------- */
+
+void UART_vidTxGetStats(UART_TxStats_t * psStats)
+{
+
+    if(IS_NULLPTR(psStats))
+    {
+        return;
+    }
+
+    /*  statistics are written from the DMA interrupt  */
+    OS_PORT_ENTER_CRITICAL();
+    *psStats = UART_sTxStats;
+    OS_PORT_EXIT_CRITICAL();
+}
+
+/* ------------------------------------------------------------------------- */
+
+void UART_vidTxDmaIrqHandler(void)
+{
+    uint32_t Local_u32Size = UART_sTxState.dma_size;
+
+    if(LL_DMA_IsActiveFlag_TE4(DMA1))
+    {
+        UART_sTxStats.errors++;
+    }
+
+    if(LL_DMA_IsActiveFlag_TC4(DMA1) || LL_DMA_IsActiveFlag_TE4(DMA1))
+    {
+        LL_DMA_ClearFlag_GI4(DMA1);
+
+        /*  release the sent region  */
+        UART_sTxState.read      = UART_sTxState.read + Local_u32Size;
+        UART_sTxState.dma_size  = 0;
+
+        UART_sTxStats.bytes += Local_u32Size;
+        UART_sTxStats.transfers++;
+    }
+
+    if(IS_ZERO(UART_sTxState.dma_size))
+    {
+        UART_vidTxStart();
+    }
+}
+
+/* ------------------------------------------------------------------------- */
@@ -0,0 +1,161 @@
+/*******************************************************************************
+ * @file    uart_tx.h
+ * @brief   DMA driven USART1 transmit channel
+ * @details Non-blocking USART1 transmission (PA9) through DMA1 channel 4.
+ *
+ *          Producers reserve contiguous space in a bipartite ring buffer, write
+ *          their data in place, and commit it. Committed data is sent by DMA in
+ *          contiguous regions, completion is handled by the DMA interrupt, which
+ *          releases the sent region and starts the next one. Data is written once,
+ *          by the producer, and never copied again.
+ *
+ *          @code
+ *          uint8_t * buffer = UART_pu8TxReserve(16);
+ *
+ *          if(buffer != NULL)
+ *          {
+ *              len = format(buffer, 16);
+ *              UART_vidTxCommit(len);
+ *          }
+ *          @endcode
+ *
+ *          Reserve/commit must be called from a single context at a time (tasks of the
+ *          co-operative scheduler). A reservation is contiguous, so at most half of
+ *          #UART_TX_BUFFER_SIZE can always be reserved once the buffer is drained.
+ *
+ *          UART_vidTxDmaIrqHandler() must be called from DMA1_Channel4_IRQHandler(), which
+ *          stm32f1xx_it.c only provides when CONF_UART_USE_TX_DMA is 1, so that firmware
+ *          not using the channel doesn't link it (and its buffer) through the vector table.
+ *
+ *          The USART baud rate is limited to PCLK2 / 16 (500 kbaud at 8 MHz).
+ *
+ *          Configuration (board_config.h):
+ *          - CONF_UART_USE_TX_DMA : provide DMA1_Channel4_IRQHandler() (default 0)
+ *          - CONF_UART_TX_BUFFER_SIZE : ring buffer size in bytes, power of 2 (default 512)
+ *          - CONF_UART_TX_IRQ_PRIORITY : DMA interrupt priority (default 14)
+ * @date    18 Oct. 2026
+ * @author  Mohammad Mohsen
+ ******************************************************************************/
+
+#ifndef UART_TX_H_
+#define UART_TX_H_
+
+#include <stdint.h>
+
+#include "board_config.h"
+
+/* ------------------------------------------------------------------------- */
+
+/**
+ * @addtogroup  uart_tx UART DMA transmit channel
+ * @{
+ * */
+
+#ifdef CONF_UART_USE_TX_DMA
+#define UART_USE_TX_DMA             CONF_UART_USE_TX_DMA
+#else
+#define UART_USE_TX_DMA             0
+#endif  /*  CONF_UART_USE_TX_DMA  */
+
+#ifdef CONF_UART_TX_BUFFER_SIZE
+#define UART_TX_BUFFER_SIZE         CONF_UART_TX_BUFFER_SIZE
+#else
+#define UART_TX_BUFFER_SIZE         512u
+#endif  /*  CONF_UART_TX_BUFFER_SIZE  */
+
+#ifdef CONF_UART_TX_IRQ_PRIORITY
+#define UART_TX_IRQ_PRIORITY        CONF_UART_TX_IRQ_PRIORITY
+#else
+#define UART_TX_IRQ_PRIORITY        14u
+#endif  /*  CONF_UART_TX_IRQ_PRIORITY  */
+
+/**
+ * @brief Transmit statistics
+ * */
+typedef struct uart_tx_stats_t {
+    uint32_t    bytes;              /**<  Bytes sent  */
+    uint32_t    transfers;          /**<  DMA transfers completed  */
+    uint32_t    rejected;           /**<  Reservations rejected (not enough contiguous space)  */
+    uint32_t    errors;             /**<  DMA transfer errors  */
+} UART_TxStats_t;
+
+/* ------------------------------------------------------------------------- */
+
+/**
+ * @brief Initialize USART1 transmitter (8N1) and its DMA channel, discards pending data.
+ * The receiver is kept if it was initialized by UART_vidRxInit() (uart_rx.h).
+ *
+ * @param [in] u32Baudrate : baud rate, at most PCLK2 / 16
+ *
+ * @return void
+ * */
+void UART_vidTxInit(uint32_t u32Baudrate);
+
+/**
+ * @brief Stop the DMA channel and disable USART1 DMA requests, pending data is discarded
+ *
+ * @param void
+ *
+ * @return void
+ * */
+void UART_vidTxDeinit(void);
+
+/**
+ * @brief Reserve contiguous space in the transmit buffer
+ *
+ * @param [in] u32Size : number of bytes to reserve
+ *
+ * @return Pointer to the reserved space, NULL if there is not enough contiguous space.
+ *         A new reservation cancels a previous uncommitted one.
+ * */
+uint8_t * UART_pu8TxReserve(uint32_t u32Size);
+
+/**
+ * @brief Commit (part of) the last reservation, and start transmission
+ *
+ * @param [in] u32Size : number of bytes to commit, at most the reserved size
+ *
+ * @return void
+ * */
+void UART_vidTxCommit(uint32_t u32Size);
+
+/**
+ * @brief Reserve, copy and commit data
+ *
+ * @param [in] pu8Data : data to send
+ * @param [in] u32Size : number of bytes
+ *
+ * @return Number of bytes queued, 0 if there is not enough contiguous space
+ * */
+uint32_t UART_u32TxWrite(const uint8_t * pu8Data, uint32_t u32Size);
+
+/**
+ * @brief Get the number of committed bytes that are not sent yet
+ *
+ * @param void
+ *
+ * @return Pending bytes
+ * */
+uint32_t UART_u32TxPending(void);
+
+/**
+ * @brief Get transmit statistics
+ *
+ * @param [out] psStats : pointer to a statistics structure to fill
+ *
+ * @return void
+ * */
+void UART_vidTxGetStats(UART_TxStats_t * psStats);
+
+/**
+ * @brief DMA1 channel 4 interrupt handler, call from DMA1_Channel4_IRQHandler()
+ *
+ * @param void
+ *
+ * @return void
+ * */
+void UART_vidTxDmaIrqHandler(void);
+
+/**@}*/
+
+#endif /* UART_TX_H_ */
@@ -0,0 +1,93 @@
+/*******************************************************************************
+ * @file    cobs.c
+ * @brief   Consistent Overhead Byte Stuffing
+ * @details COBS encoder & decoder, see cobs.h
+ * @date    18 Oct. 2026
+ * @author  Mohammad Mohsen
+ ******************************************************************************/
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "utils/utils.h"
+
+#include "utils/cobs.h"
+
+/* ------------------------------------------------------------------------- */
+
+uint32_t COBS_u32Encode(const uint8_t * pu8In, uint32_t u32Size, uint8_t * pu8Out)
+{
+    uint32_t Local_u32Read  = 0;
+    uint32_t Local_u32Write = 1;
+    uint32_t Local_u32Code  = 0;
+    uint8_t  Local_u8Code   = 1;
+
+    /*  each block starts with a code byte: offset to the next zero (or block end)  */
+    while(Local_u32Read < u32Size)
+    {
+        if(IS_ZERO(pu8In[Local_u32Read]))
+        {
+            pu8Out[Local_u32Code] = Local_u8Code;
+            Local_u8Code    = 1;
+            Local_u32Code   = Local_u32Write++;
+        }
+        else
+        {
+            pu8Out[Local_u32Write++] = pu8In[Local_u32Read];
+            Local_u8Code++;
+
+            if(Local_u8Code == 0xFFu)
+            {
+                pu8Out[Local_u32Code] = Local_u8Code;
+                Local_u8Code    = 1;
+                Local_u32Code   = Local_u32Write++;
+            }
+        }
+
+        Local_u32Read++;
+    }
+
+    pu8Out[Local_u32Code] = Local_u8Code;
+
+    return Local_u32Write;
+}
+
+/* ------------------------------------------------------------------------- */
+
+uint32_t COBS_u32Decode(const uint8_t * pu8In, uint32_t u32Size, uint8_t * pu8Out)
+{
+    uint32_t Local_u32Read  = 0;
+    uint32_t Local_u32Write = 0;
+    uint32_t Local_u32Code;
+    uint32_t Local_u32Idx;
+
+    while(Local_u32Read < u32Size)
+    {
+        Local_u32Code = pu8In[Local_u32Read++];
+
+        if(IS_ZERO(Local_u32Code))
+        {
+            return 0;
+        }
+
+        for(Local_u32Idx = 1; Local_u32Idx < Local_u32Code; Local_u32Idx++)
+        {
+            if((Local_u32Read >= u32Size) || IS_ZERO(pu8In[Local_u32Read]))
+            {
+                return 0;
+            }
+
+            pu8Out[Local_u32Write++] = pu8In[Local_u32Read++];
+        }
+
+        /*  a block shorter than 254 bytes ends with a zero, except the last one  */
+        if((Local_u32Code != 0xFFu) && (Local_u32Read < u32Size))
+        {
+            pu8Out[Local_u32Write++] = 0;
+        }
+    }
+
+    return Local_u32Write;
+}
+
+/* ------------------------------------------------------------------------- */
@@ -0,0 +1,54 @@
+/*******************************************************************************
+ * @file    cobs.h
+ * @brief   Consistent Overhead Byte Stuffing
+ * @details COBS encoding removes all zero bytes from a packet, at a cost of one
+ *          byte per 254 bytes (plus one), so a zero byte can delimit packets on a
+ *          byte stream. The delimiter is not written by COBS_u32Encode().
+ * @date    18 Oct. 2026
+ * @author  Mohammad Mohsen
+ ******************************************************************************/
+
+#ifndef COBS_H_
+#define COBS_H_
+
+#include <stdint.h>
+
+/* ------------------------------------------------------------------------- */
+
+/**
+ * @addtogroup  cobs COBS
+ * @{
+ * */
+
+/**
+ * @brief Maximum encoded size of a packet of @p size bytes (without delimiter)
+ * */
+#define COBS_MAX_ENCODED_SIZE(size)     ((size) + ((size) / 254u) + 1u)
+
+/* ------------------------------------------------------------------------- */
+
+/**
+ * @brief Encode a packet
+ *
+ * @param [in]  pu8In   : packet
+ * @param [in]  u32Size : packet size
+ * @param [out] pu8Out  : encoded packet, at least COBS_MAX_ENCODED_SIZE(u32Size) bytes, must not overlap @p pu8In
+ *
+ * @return Encoded size
+ * */
+uint32_t COBS_u32Encode(const uint8_t * pu8In, uint32_t u32Size, uint8_t * pu8Out);
+
+/**
+ * @brief Decode a packet (without delimiter)
+ *
+ * @param [in]  pu8In   : encoded packet
+ * @param [in]  u32Size : encoded packet size
+ * @param [out] pu8Out  : decoded packet, at least @p u32Size bytes, can be @p pu8In (in place)
+ *
+ * @return Decoded size, 0 if the packet is not valid (or empty)
+ * */
+uint32_t COBS_u32Decode(const uint8_t * pu8In, uint32_t u32Size, uint8_t * pu8Out);
+
+/**@}*/
+
+#endif /* COBS_H_ */
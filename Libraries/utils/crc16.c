@@ -0,0 +1,40 @@
+/*******************************************************************************
+ * @file    crc16.c
+ * @brief   CRC-16/CCITT-FALSE
+ * @details Nibble table implementation, see crc16.h
+ * @date    18 Oct. 2026
+ * @author  Mohammad Mohsen
+ ******************************************************************************/
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "utils/crc16.h"
+
+/* ------------------------------------------------------------------------- */
+
+/**
+ * CRC of each nibble value, polynomial 0x1021
+ * */
+static const uint16_t CRC16_au16Table [16] = {
+        0x0000u, 0x1021u, 0x2042u, 0x3063u, 0x4084u, 0x50A5u, 0x60C6u, 0x70E7u,
+        0x8108u, 0x9129u, 0xA14Au, 0xB16Bu, 0xC18Cu, 0xD1ADu, 0xE1CEu, 0xF1EFu,
+};
+
+/* ------------------------------------------------------------------------- */
+
+uint16_t CRC16_u16Update(uint16_t u16Crc, const uint8_t * pu8Data, uint32_t u32Size)
+{
+    uint32_t Local_u32Crc = u16Crc;
+    uint32_t Local_u32Idx;
+
+    for(Local_u32Idx = 0; Local_u32Idx < u32Size; Local_u32Idx++)
+    {
+        Local_u32Crc = (Local_u32Crc << 4) ^ CRC16_au16Table[((Local_u32Crc >> 12) ^ (pu8Data[Local_u32Idx] >> 4)) & 0x0Fu];
+        Local_u32Crc = (Local_u32Crc << 4) ^ CRC16_au16Table[((Local_u32Crc >> 12) ^ pu8Data[Local_u32Idx]) & 0x0Fu];
+    }
+
+    return (uint16_t)Local_u32Crc;
+}
+
+/* ------------------------------------------------------------------------- */
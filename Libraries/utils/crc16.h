@@ -0,0 +1,42 @@
+/*******************************************************************************
+ * @file    crc16.h
+ * @brief   CRC-16/CCITT-FALSE
+ * @details Polynomial 0x1021, initial value 0xFFFF, no reflection, no final XOR.
+ *          Computed 4 bits at a time, with a 16-entry table (32 bytes of flash).
+ * @date    18 Oct. 2026
+ * @author  Mohammad Mohsen
+ ******************************************************************************/
+
+#ifndef CRC16_H_
+#define CRC16_H_
+
+#include <stdint.h>
+
+/* ------------------------------------------------------------------------- */
+
+/**
+ * @addtogroup  crc16 CRC-16
+ * @{
+ * */
+
+/**
+ * @brief Initial CRC value
+ * */
+#define CRC16_INIT                  0xFFFFu
+
+/* ------------------------------------------------------------------------- */
+
+/**
+ * @brief Update a CRC with a block of data
+ *
+ * @param [in] u16Crc   : current CRC, #CRC16_INIT for the first block
+ * @param [in] pu8Data  : data
+ * @param [in] u32Size  : data size
+ *
+ * @return Updated CRC
+ * */
+uint16_t CRC16_u16Update(uint16_t u16Crc, const uint8_t * pu8Data, uint32_t u32Size);
+
+/**@}*/
+
+#endif /* CRC16_H_ */
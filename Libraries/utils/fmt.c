@@ -0,0 +1,403 @@
+/*******************************************************************************
+ * @file    fmt.c
+ * @brief   Integer & fixed-point formatting
+ * @details Number conversion & format string subset, see fmt.h
+ * @date    18 Oct. 2026
+ * @author  Mohammad Mohsen
+ ******************************************************************************/
+
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "utils/utils.h"
+
+#include "utils/fmt.h"
+
+/* ------------------------------------------------------------------------- */
+
+/**
+ * @brief x / 100 = (x * FMT_DIV100_MAGIC) >> FMT_DIV100_SHIFT, exact for all 32-bit x
+ * */
+#define FMT_DIV100_MAGIC            0x51EB851Fu
+#define FMT_DIV100_SHIFT            37u
+
+/**
+ * @brief Conversion flags
+ * */
+#define FMT_FLAG_LEFT               0x01u   /**<  `-`: pad on the right  */
+#define FMT_FLAG_ZERO               0x02u   /**<  `0`: pad numbers with zeros  */
+#define FMT_FLAG_PRECISION          0x04u   /**<  Precision is given  */
+
+/* ------------------------------------------------------------------------- */
+
+/**
+ * Two digit decimal numbers, "00" to "99"
+ * */
+static const char FMT_acDigitPairs [200] =
+        "00010203040506070809"
+        "10111213141516171819"
+        "20212223242526272829"
+        "30313233343536373839"
+        "40414243444546474849"
+        "50515253545556575859"
+        "60616263646566676869"
+        "70717273747576777879"
+        "80818283848586878889"
+        "90919293949596979899";
+
+/**
+ * Hexadecimal digits, lower case & upper case
+ * */
+static const char FMT_acHexLower [] = "0123456789abcdef";
+static const char FMT_acHexUpper [] = "0123456789ABCDEF";
+
+/**
+ * Powers of 10
+ * */
+static const uint32_t FMT_au32Pow10 [10] = {
+        1u, 10u, 100u, 1000u, 10000u, 100000u, 1000000u, 10000000u, 100000000u, 1000000000u,
+};
+
+/* ------------------------------------------------------------------------- */
+
+/**
+ * @brief Number of decimal digits of a value
+ * */
+static inline uint32_t FMT_u32DecimalDigits(uint32_t u32Value)
+{
+    /*  log10(x) ~= log2(x) * 1233 / 4096, then corrected by one comparison (0 has 1 digit)  */
+    uint32_t Local_u32Digits = ((32u - (uint32_t)__builtin_clz(u32Value | 1u)) * 1233u) >> 12;
+
+    return Local_u32Digits + ((Local_u32Digits < 10u) && ((u32Value | 1u) >= FMT_au32Pow10[Local_u32Digits]));
+}
+
+/**
+ * @brief Write a hexadecimal number, with a digit set
+ * */
+static uint32_t FMT_u32HexDigits(char * pcBuffer, uint32_t u32Value, uint32_t u32Digits, const char * pcDigits)
+{
+    uint32_t Local_u32Idx;
+
+    if(IS_ZERO(u32Digits))
+    {
+        u32Digits = (35u - (uint32_t)__builtin_clz(u32Value | 1u)) >> 2;
+    }
+
+    u32Digits = MIN(u32Digits, FMT_HEX_MAX_SIZE);
+
+    for(Local_u32Idx = u32Digits; Local_u32Idx; Local_u32Idx--)
+    {
+        pcBuffer[Local_u32Idx - 1u] = pcDigits[u32Value & 0x0Fu];
+        u32Value >>= 4;
+    }
+
+    return u32Digits;
+}
+
+/* ------------------------------------------------------------------------- */
+
+uint32_t FMT_u32Unsigned(char * pcBuffer, uint32_t u32Value)
+{
+    uint32_t Local_u32Size = FMT_u32DecimalDigits(u32Value);
+    char * Local_pcDigit = &pcBuffer[Local_u32Size];
+    uint32_t Local_u32Quotient;
+    uint32_t Local_u32Pair;
+
+    /*  two digits per step, from the end  */
+    while(u32Value >= 100u)
+    {
+        Local_u32Quotient   = (uint32_t)(((uint64_t)u32Value * FMT_DIV100_MAGIC) >> FMT_DIV100_SHIFT);
+        Local_u32Pair       = (u32Value - (Local_u32Quotient * 100u)) * 2u;
+        u32Value            = Local_u32Quotient;
+
+        *--Local_pcDigit = FMT_acDigitPairs[Local_u32Pair + 1u];
+        *--Local_pcDigit = FMT_acDigitPairs[Local_u32Pair];
+    }
+
+    if(u32Value >= 10u)
+    {
+        *--Local_pcDigit = FMT_acDigitPairs[(u32Value * 2u) + 1u];
+        *--Local_pcDigit = FMT_acDigitPairs[u32Value * 2u];
+    }
+    else
+    {
+        *--Local_pcDigit = (char)('0' + u32Value);
+    }
+
+    return Local_u32Size;
+}
+
+/* ------------------------------------------------------------------------- */
+
+uint32_t FMT_u32Signed(char * pcBuffer, int32_t s32Value)
+{
+    if(s32Value < 0)
+    {
+        pcBuffer[0] = '-';
+        return FMT_u32Unsigned(&pcBuffer[1], 0u - (uint32_t)s32Value) + 1u;
+    }
+
+    return FMT_u32Unsigned(pcBuffer, (uint32_t)s32Value);
+}
+
+/* ------------------------------------------------------------------------- */
+
+uint32_t FMT_u32Hex(char * pcBuffer, uint32_t u32Value, uint32_t u32Digits)
+{
+    return FMT_u32HexDigits(pcBuffer, u32Value, u32Digits, FMT_acHexLower);
+}
+
+/* ------------------------------------------------------------------------- */
+
+uint32_t FMT_u32Fixed(char * pcBuffer, int32_t s32Value, uint32_t u32FracBits, uint32_t u32Decimals)
+{
+    uint32_t Local_u32Size = 0;
+    uint32_t Local_u32Magnitude = (s32Value < 0) ? (0u - (uint32_t)s32Value) : (uint32_t)s32Value;
+    uint32_t Local_u32Integer;
+    uint64_t Local_u64Fraction;
+    uint32_t Local_u32Fraction;
+    uint32_t Local_u32Idx;
+
+    u32FracBits = MIN(u32FracBits, 31u);
+    u32Decimals = MIN(u32Decimals, FMT_FIXED_MAX_DECIMALS);
+
+    Local_u32Integer    = Local_u32Magnitude >> u32FracBits;
+    Local_u64Fraction   = Local_u32Magnitude & ((1u << u32FracBits) - 1u);
+
+    /*  fraction * 10 ^ decimals, rounded to the nearest  */
+    Local_u64Fraction   = ((Local_u64Fraction * FMT_au32Pow10[u32Decimals]) + ((1u << u32FracBits) >> 1)) >> u32FracBits;
+    Local_u32Fraction   = (uint32_t)Local_u64Fraction;
+
+    if(Local_u32Fraction >= FMT_au32Pow10[u32Decimals])
+    {
+        Local_u32Fraction -= FMT_au32Pow10[u32Decimals];
+        Local_u32Integer++;
+    }
+
+    if(s32Value < 0)
+    {
+        pcBuffer[Local_u32Size++] = '-';
+    }
+
+    Local_u32Size += FMT_u32Unsigned(&pcBuffer[Local_u32Size], Local_u32Integer);
+
+    if(u32Decimals)
+    {
+        pcBuffer[Local_u32Size++] = '.';
+
+        for(Local_u32Idx = u32Decimals; Local_u32Idx; Local_u32Idx--)
+        {
+            pcBuffer[Local_u32Size + Local_u32Idx - 1u] = (char)('0' + (Local_u32Fraction % 10u));
+            Local_u32Fraction /= 10u;
+        }
+
+        Local_u32Size += u32Decimals;
+    }
+
+    return Local_u32Size;
+}
+
+/* ------------------------------------------------------------------------- */
+
+uint32_t FMT_u32VFormat(char * pcBuffer, uint32_t u32Size, const char * pcFormat, va_list xArgs)
+{
+    char Local_acField[FMT_FIXED_MAX_SIZE];
+    const char * Local_pcField;
+    uint32_t Local_u32FieldSize;
+    uint32_t Local_u32Length = 0;
+    uint32_t Local_u32Flags;
+    uint32_t Local_u32Width;
+    uint32_t Local_u32Precision;
+    uint32_t Local_u32Sign;
+    uint32_t Local_u32Value;
+    int32_t  Local_s32Value;
+
+    if(IS_ZERO(u32Size))
+    {
+        return 0;
+    }
+
+    /*  last byte is kept for the terminating NUL  */
+    u32Size--;
+
+    while(*pcFormat && (Local_u32Length < u32Size))
+    {
+        if(*pcFormat != '%')
+        {
+            pcBuffer[Local_u32Length++] = *pcFormat++;
+            continue;
+        }
+
+        pcFormat++;
+
+        Local_u32Flags      = 0;
+        Local_u32Width      = 0;
+        Local_u32Precision  = 0;
+        Local_u32Sign       = 0;
+
+        for(;; pcFormat++)
+        {
+            if(*pcFormat == '-')
+            {
+                Local_u32Flags |= FMT_FLAG_LEFT;
+            }
+            else if(*pcFormat == '0')
+            {
+                Local_u32Flags |= FMT_FLAG_ZERO;
+            }
+            else
+            {
+                break;
+            }
+        }
+
+        while((*pcFormat >= '0') && (*pcFormat <= '9'))
+        {
+            Local_u32Width = (Local_u32Width * 10u) + (uint32_t)(*pcFormat++ - '0');
+        }
+
+        if(*pcFormat == '.')
+        {
+            Local_u32Flags |= FMT_FLAG_PRECISION;
+            pcFormat++;
+
+            while((*pcFormat >= '0') && (*pcFormat <= '9'))
+            {
+                Local_u32Precision = (Local_u32Precision * 10u) + (uint32_t)(*pcFormat++ - '0');
+            }
+        }
+
+        /*  long is 32-bit  */
+        while(*pcFormat == 'l')
+        {
+            pcFormat++;
+        }
+
+        Local_pcField = Local_acField;
+
+        switch(*pcFormat)
+        {
+            case 'd':
+            case 'i':
+                Local_s32Value      = (int32_t)va_arg(xArgs, int);
+                Local_u32FieldSize  = FMT_u32Signed(Local_acField, Local_s32Value);
+                Local_u32Sign       = (Local_s32Value < 0);
+                break;
+
+            case 'u':
+                Local_u32FieldSize  = FMT_u32Unsigned(Local_acField, (uint32_t)va_arg(xArgs, unsigned int));
+                break;
+
+            case 'x':
+            case 'X':
+                Local_u32Value      = (uint32_t)va_arg(xArgs, unsigned int);
+                Local_u32Precision  = MIN(Local_u32Precision, FMT_HEX_MAX_SIZE);
+
+                /*  minimum number of digits  */
+                if(Local_u32Precision && (Local_u32Precision < ((35u - (uint32_t)__builtin_clz(Local_u32Value | 1u)) >> 2)))
+                {
+                    Local_u32Precision = 0;
+                }
+
+                Local_u32FieldSize  = FMT_u32HexDigits(Local_acField, Local_u32Value, Local_u32Precision,
+                                                       (*pcFormat == 'x') ? FMT_acHexLower : FMT_acHexUpper);
+                break;
+
+            case 'p':
+                Local_acField[0]    = '0';
+                Local_acField[1]    = 'x';
+                Local_u32FieldSize  = FMT_u32Hex(&Local_acField[2], (uint32_t)(uintptr_t)va_arg(xArgs, void *), FMT_HEX_MAX_SIZE) + 2u;
+                break;
+
+            case 'q':
+                Local_s32Value      = (int32_t)va_arg(xArgs, int);
+                Local_u32Value      = (uint32_t)va_arg(xArgs, unsigned int);
+                Local_u32FieldSize  = FMT_u32Fixed(Local_acField, Local_s32Value, Local_u32Value,
+                                                   (Local_u32Flags & FMT_FLAG_PRECISION) ? Local_u32Precision : 3u);
+                Local_u32Sign       = (Local_s32Value < 0);
+                break;
+
+            case 'c':
+                Local_acField[0]    = (char)va_arg(xArgs, int);
+                Local_u32FieldSize  = 1;
+                Local_u32Flags     &= ~FMT_FLAG_ZERO;
+                break;
+
+            case 's':
+                Local_pcField       = va_arg(xArgs, const char *);
+                Local_pcField       = IS_NULLPTR(Local_pcField) ? "(null)" : Local_pcField;
+                Local_u32FieldSize  = (uint32_t)strlen(Local_pcField);
+                Local_u32Flags     &= ~FMT_FLAG_ZERO;
+
+                if(Local_u32Flags & FMT_FLAG_PRECISION)
+                {
+                    Local_u32FieldSize = MIN(Local_u32FieldSize, Local_u32Precision);
+                }
+                break;
+
+            case '%':
+                Local_acField[0]    = '%';
+                Local_u32FieldSize  = 1;
+                Local_u32Width      = 0;
+                break;
+
+            default:
+                /*  unsupported conversion, or end of the format string  */
+                Local_u32FieldSize  = 0;
+                Local_u32Width      = 0;
+                break;
+        }
+
+        if(*pcFormat)
+        {
+            pcFormat++;
+        }
+
+        /*  sign is written before zero padding  */
+        if(Local_u32Sign && (Local_u32Flags & FMT_FLAG_ZERO) && (Local_u32Length < u32Size))
+        {
+            pcBuffer[Local_u32Length++] = *Local_pcField++;
+            Local_u32FieldSize--;
+            Local_u32Width -= (Local_u32Width > 0u);
+        }
+
+        if(!(Local_u32Flags & FMT_FLAG_LEFT))
+        {
+            for(; (Local_u32Width > Local_u32FieldSize) && (Local_u32Length < u32Size); Local_u32Width--)
+            {
+                pcBuffer[Local_u32Length++] = (Local_u32Flags & FMT_FLAG_ZERO) ? '0' : ' ';
+            }
+        }
+
+        Local_u32FieldSize = MIN(Local_u32FieldSize, u32Size - Local_u32Length);
+        memcpy(&pcBuffer[Local_u32Length], Local_pcField, Local_u32FieldSize);
+        Local_u32Length += Local_u32FieldSize;
+
+        for(; (Local_u32Width > Local_u32FieldSize) && (Local_u32Length < u32Size); Local_u32Width--)
+        {
+            pcBuffer[Local_u32Length++] = ' ';
+        }
+    }
+
+    pcBuffer[Local_u32Length] = '\0';
+
+    return Local_u32Length;
+}
+
+/* ------------------------------------------------------------------------- */
+
+uint32_t FMT_u32Format(char * pcBuffer, uint32_t u32Size, const char * pcFormat, ...)
+{
+    va_list Local_xArgs;
+    uint32_t Local_u32Length;
+
+    va_start(Local_xArgs, pcFormat);
+    Local_u32Length = FMT_u32VFormat(pcBuffer, u32Size, pcFormat, Local_xArgs);
+    va_end(Local_xArgs);
+
+    return Local_u32Length;
+}
+
+/* ------------------------------------------------------------------------- */
@@ -0,0 +1,121 @@
+/*******************************************************************************
+ * @file    fmt.h
+ * @brief   Integer & fixed-point formatting
+ * @details Freestanding replacement for the printf family: no heap, no stdio,
+ *          no floating point. Numbers are written to caller supplied buffers.
+ *
+ *          Decimal conversion writes two digits per step, dividing by 100 with a
+ *          reciprocal multiplication (one UMULL), and the number of digits is known
+ *          before any digit is written, so digits are written in place.
+ *
+ *          The number functions don't write a terminating NUL, they return the number
+ *          of characters written. FMT_u32Format() supports a printf subset:
+ *          `%[-][0][width][.precision]conversion`, conversions:
+ *          - `d`, `i`, `u` : 32-bit signed / unsigned decimal (`l` modifier is accepted)
+ *          - `x`, `X`     : hexadecimal, precision is the minimum number of digits
+ *          - `q`          : fixed-point, takes 2 arguments: an int32_t value and its number
+ *                           of fraction bits (e.g. 16 for Q16.16), precision is the number
+ *                           of decimals (default 3)
+ *          - `c`, `s`, `p`, `%`
+ * @date    18 Oct. 2026
+ * @author  Mohammad Mohsen
+ ******************************************************************************/
+
+#ifndef FMT_H_
+#define FMT_H_
+
+#include <stdarg.h>
+#include <stdint.h>
+
+/* ------------------------------------------------------------------------- */
+
+/**
+ * @addtogroup  fmt Formatting
+ * @{
+ * */
+
+/**
+ * @brief Largest number of characters written by the number functions
+ * */
+#define FMT_UNSIGNED_MAX_SIZE       10u     /**<  FMT_u32Unsigned()  */
+#define FMT_SIGNED_MAX_SIZE         11u     /**<  FMT_u32Signed()  */
+#define FMT_HEX_MAX_SIZE            8u      /**<  FMT_u32Hex()  */
+#define FMT_FIXED_MAX_SIZE          21u     /**<  FMT_u32Fixed(), 9 decimals  */
+
+/**
+ * @brief Maximum number of decimals of fixed-point numbers
+ * */
+#define FMT_FIXED_MAX_DECIMALS      9u
+
+/* ------------------------------------------------------------------------- */
+
+/**
+ * @brief Write an unsigned decimal number
+ *
+ * @param [out] pcBuffer : output, at least #FMT_UNSIGNED_MAX_SIZE characters
+ * @param [in]  u32Value : value
+ *
+ * @return Number of characters written
+ * */
+uint32_t FMT_u32Unsigned(char * pcBuffer, uint32_t u32Value);
+
+/**
+ * @brief Write a signed decimal number
+ *
+ * @param [out] pcBuffer : output, at least #FMT_SIGNED_MAX_SIZE characters
+ * @param [in]  s32Value : value
+ *
+ * @return Number of characters written
+ * */
+uint32_t FMT_u32Signed(char * pcBuffer, int32_t s32Value);
+
+/**
+ * @brief Write a hexadecimal number (lower case, no prefix)
+ *
+ * @param [out] pcBuffer  : output, at least #FMT_HEX_MAX_SIZE characters
+ * @param [in]  u32Value  : value
+ * @param [in]  u32Digits : number of digits, [1: 8], 0 for as few digits as needed
+ *
+ * @return Number of characters written
+ * */
+uint32_t FMT_u32Hex(char * pcBuffer, uint32_t u32Value, uint32_t u32Digits);
+
+/**
+ * @brief Write a fixed-point number in decimal, rounded to the nearest
+ *
+ * @param [out] pcBuffer    : output, at least #FMT_FIXED_MAX_SIZE characters
+ * @param [in]  s32Value    : value
+ * @param [in]  u32FracBits : number of fraction bits of @p s32Value, [0: 31]
+ * @param [in]  u32Decimals : number of decimals, [0: #FMT_FIXED_MAX_DECIMALS]
+ *
+ * @return Number of characters written
+ * */
+uint32_t FMT_u32Fixed(char * pcBuffer, int32_t s32Value, uint32_t u32FracBits, uint32_t u32Decimals);
+
+/**
+ * @brief Format a string (printf subset, see fmt.h)
+ *
+ * @param [out] pcBuffer  : output, always NUL terminated (if @p u32Size > 0)
+ * @param [in]  u32Size   : size of @p pcBuffer, including the terminating NUL
+ * @param [in]  pcFormat  : format string
+ *
+ * @return Number of characters written, excluding the terminating NUL.
+ *         Output is truncated to @p u32Size - 1 characters.
+ * */
+uint32_t FMT_u32Format(char * pcBuffer, uint32_t u32Size, const char * pcFormat, ...);
+
+/**
+ * @brief Format a string (printf subset, see fmt.h), va_list version
+ *
+ * @param [out] pcBuffer  : output, always NUL terminated (if @p u32Size > 0)
+ * @param [in]  u32Size   : size of @p pcBuffer, including the terminating NUL
+ * @param [in]  pcFormat  : format string
+ * @param [in]  xArgs     : arguments
+ *
+ * @return Number of characters written, excluding the terminating NUL
+ * */
+uint32_t FMT_u32VFormat(char * pcBuffer, uint32_t u32Size, const char * pcFormat, va_list xArgs);
+
+/**@}*/
+
+#endif /* FMT_H_ */
@@ -0,0 +1,135 @@
+#!/usr/bin/env python3
+"""Generate the shell's command table (Libraries/shell) as a perfect hash table.
+
+Commands are listed in a definition file, one per line:
+
+    name    handler                 "help text"
+
+The generator searches a hash seed for which every command lands in its own
+slot of a power of 2 table, so a command lookup on the target is one hash of
+the typed word and one string compare, whatever the number of commands:
+
+    python3 Tools/gen_shell_cmds.py Libraries/shell/shell_cmds.def Libraries/shell/shell_table.h
+
+The hash must match SHELL_u32Hash() in shell.c: 32-bit FNV-1a with the seed as
+offset basis, the slot is the top bits of the hash.
+"""
+
+import argparse
+import re
+import shlex
+import sys
+
+FNV_PRIME = 0x01000193
+MAX_SEEDS = 1 << 20
+
+NAME_RE = re.compile(r"^[A-Za-z0-9_.\-]+$")
+HANDLER_RE = re.compile(r"^[A-Za-z_][A-Za-z0-9_]*$")
+
+
+def fnv1a(seed, name):
+    h = seed
+    for byte in name.encode():
+        h = ((h ^ byte) * FNV_PRIME) & 0xFFFFFFFF
+    return h
+
+
+def parse(path):
+    commands = []
+    with open(path) as f:
+        for number, line in enumerate(f, 1):
+            line = line.strip()
+            if not line or line.startswith("#"):
+                continue
+            fields = shlex.split(line)
+            if len(fields) != 3 or not NAME_RE.match(fields[0]) or not HANDLER_RE.match(fields[1]):
+                sys.exit("%s:%d: expected: name handler \"help\"" % (path, number))
+            if any(fields[0] == command[0] for command in commands):
+                sys.exit("%s:%d: duplicate command %s" % (path, number, fields[0]))
+            commands.append(tuple(fields))
+    if not commands:
+        sys.exit("%s: no commands" % path)
+    return commands
+
+
+def search(names):
+    """Return (seed, bits) of the smallest collision free table."""
+    bits = max(1, (len(names) - 1).bit_length())
+    while bits < 16:
+        shift = 32 - bits
+        for seed in range(MAX_SEEDS):
+            slots = {fnv1a(seed, name) >> shift for name in names}
+            if len(slots) == len(names):
+                return seed, bits
+        bits += 1
+    sys.exit("no perfect hash found")
+
+
+def c_string(text):
+    return '"%s"' % text.replace("\\", "\\\\").replace('"', '\\"')
+
+
+def generate(commands, seed, bits, source):
+    shift = 32 - bits
+    table = [None] * (1 << bits)
+    for command in commands:
+        table[fnv1a(seed, command[0]) >> shift] = command
+
+    lines = [
+        "/*******************************************************************************",
+        " * @file    shell_table.h",
+        " * @brief   Shell command table",
+        " * @details Generated by Tools/gen_shell_cmds.py from %s, do not edit." % source,
+        " *          Perfect hash table, see shell.c",
+        " ******************************************************************************/",
+        "",
+        "#ifndef SHELL_TABLE_H_",
+        "#define SHELL_TABLE_H_",
+        "",
+        "#include <stddef.h>",
+        "#include <stdint.h>",
+        "",
+        '#include "shell/shell.h"',
+        "",
+        "/* ------------------------------------------------------------------------- */",
+        "",
+        "#define SHELL_HASH_SEED             0x%08Xu" % seed,
+        "#define SHELL_HASH_SHIFT            %uu" % shift,
+        "#define SHELL_TABLE_SIZE            %uu" % len(table),
+        "",
+    ]
+    for handler in sorted({command[1] for command in commands}):
+        lines.append("uint32_t %s(uint32_t u32Argc, char * const apcArgv[], uint32_t u32Step);" % handler)
+    lines += [
+        "",
+        "static const SHELL_Command_t SHELL_asCommands [SHELL_TABLE_SIZE] = {",
+    ]
+    for index, command in enumerate(table):
+        if command is None:
+            lines.append("    [%2u] = {NULL, NULL, NULL}," % index)
+        else:
+            lines.append("    [%2u] = {%s, %s, %s}," % (index, c_string(command[0]), command[1], c_string(command[2])))
+    lines += [
+        "};",
+        "",
+        "#endif /* SHELL_TABLE_H_ */",
+        "",
+    ]
+    return "\n".join(lines)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("definitions", help="command definition file")
+    parser.add_argument("output", help="generated header")
+    args = parser.parse_args()
+
+    commands = parse(args.definitions)
+    seed, bits = search([command[0] for command in commands])
+
+    with open(args.output, "w") as f:
+        f.write(generate(commands, seed, bits, args.definitions.replace("\\", "/").split("/")[-1]))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,177 @@
+#!/usr/bin/env python3
+"""Decode the binary log stream of Libraries/log into text.
+
+Log calls on the target only send a message ID and raw arguments. The messages
+(level letter, location and format string) are read from the `.log_strings`
+section of the firmware's ELF file, a message's ID is its address in that section.
+
+Decode a captured stream, or read it live from a serial port (needs pyserial):
+
+    python3 Tools/log_decode.py build/Debug/SimpleOS.elf log.bin
+    python3 Tools/log_decode.py build/Debug/SimpleOS.elf --port /dev/ttyUSB0 --baud 115200
+
+Stream records:
+
+    0xA0 | n, LEB128 message ID, n LEB128 arguments    (n = 0..4)
+    0xAF, LEB128 count                                  (records lost on the target)
+
+The decoder resynchronizes on the next tag byte after an unknown byte or ID.
+"""
+
+import argparse
+import re
+import struct
+import sys
+
+SECTION = ".log_strings"
+TAG_RECORD = 0xA0
+TAG_LOST = 0xAF
+MAX_ARGS = 4
+ID_MASK = 0x00FFFFFF
+
+CONVERSION_RE = re.compile(r"%([-+ #0]*)(\d+|\*)?(?:\.(\d+))?(hh|h|ll|l|z|j|t)?([diouxXcpfFeEgGs%])")
+
+
+def read_section(path, name):
+    """Return (address, bytes) of an ELF section, ELF32/ELF64 little endian."""
+    with open(path, "rb") as f:
+        elf = f.read()
+    if elf[:4] != b"\x7fELF":
+        sys.exit("%s: not an ELF file" % path)
+    if elf[5] != 1:
+        sys.exit("%s: big endian ELF files are not supported" % path)
+    if elf[4] == 1:
+        shoff, = struct.unpack_from("<I", elf, 0x20)
+        shentsize, shnum, shstrndx = struct.unpack_from("<HHH", elf, 0x2E)
+        shdr = struct.Struct("<IIIIIIIIII")
+    else:
+        shoff, = struct.unpack_from("<Q", elf, 0x28)
+        shentsize, shnum, shstrndx = struct.unpack_from("<HHH", elf, 0x3A)
+        shdr = struct.Struct("<IIQQQQIIQQ")
+    sections = [shdr.unpack_from(elf, shoff + i * shentsize) for i in range(shnum)]
+    strtab = sections[shstrndx]
+    for sh_name, _type, _flags, addr, offset, size in (s[:6] for s in sections):
+        start = strtab[4] + sh_name
+        if elf[start:elf.index(b"\0", start)].decode() == name:
+            return addr, elf[offset:offset + size]
+    sys.exit("%s: no %s section, the firmware doesn't use Libraries/log" % (path, name))
+
+
+def load_messages(path):
+    """Map message IDs to (level, location, format)."""
+    base, data = read_section(path, SECTION)
+    messages = {}
+    offset = 0
+    while offset < len(data):
+        # entries are "<level>\0<file:line>\0<format>\0", padded with NULs by alignment
+        if data[offset] == 0:
+            offset += 1
+            continue
+        fields = data[offset:].split(b"\0", 3)
+        if len(fields) < 3:
+            break
+        level, location, fmt = (field.decode(errors="replace") for field in fields[:3])
+        messages[(base + offset) & ID_MASK] = (level, location, fmt)
+        offset += len(fields[0]) + len(fields[1]) + len(fields[2]) + 3
+    return messages
+
+
+def format_message(fmt, args):
+    args = list(args)
+
+    def convert(match):
+        flags, width, precision, _length, conv = match.groups()
+        if conv == "%":
+            return "%"
+        if not args:
+            return match.group(0)
+        value = args.pop(0)
+        spec = "%" + flags + (width or "") + ("." + precision if precision else "")
+        if conv in "di":
+            return (spec + "d") % (value - (1 << 32) if value & 0x80000000 else value)
+        if conv == "p":
+            return "0x%08x" % value
+        if conv in "fFeEgG":
+            return (spec + conv) % struct.unpack("<f", struct.pack("<I", value))[0]
+        if conv == "c":
+            return chr(value & 0xFF)
+        if conv == "s":
+            return "<str@0x%08x>" % value
+        return (spec + conv) % value
+
+    return CONVERSION_RE.sub(convert, fmt)
+
+
+def leb128(stream):
+    value = 0
+    for shift in range(0, 35, 7):
+        byte = next(stream)
+        value |= (byte & 0x7F) << shift
+        if not byte & 0x80:
+            return value & 0xFFFFFFFF
+    raise ValueError("LEB128 value too long")
+
+
+def decode(stream, messages, out):
+    """Decode records from a byte iterator, return the number of skipped bytes."""
+    skipped = 0
+    stream = iter(stream)
+    for tag in stream:
+        try:
+            if tag == TAG_LOST:
+                out.write("! %u records lost\n" % leb128(stream))
+                continue
+            count = tag - TAG_RECORD
+            if not 0 <= count <= MAX_ARGS:
+                skipped += 1
+                continue
+            message = messages.get(leb128(stream))
+            args = [leb128(stream) for _ in range(count)]
+        except (StopIteration, ValueError):
+            skipped += 1
+            continue
+        if message is None:
+            skipped += 1
+            continue
+        level, location, fmt = message
+        out.write("%s %s: %s\n" % (level, location, format_message(fmt, args)))
+        out.flush()
+    return skipped
+
+
+def serial_bytes(port, baud):
+    import serial
+    with serial.Serial(port, baud) as link:
+        while True:
+            for byte in link.read(link.in_waiting or 1):
+                yield byte
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("elf", help="firmware ELF file")
+    parser.add_argument("stream", nargs="?", help="captured binary stream (default: stdin)")
+    parser.add_argument("--port", help="read from a serial port instead")
+    parser.add_argument("--baud", type=int, default=115200)
+    args = parser.parse_args()
+
+    messages = load_messages(args.elf)
+
+    if args.port:
+        data = serial_bytes(args.port, args.baud)
+    elif args.stream:
+        with open(args.stream, "rb") as f:
+            data = f.read()
+    else:
+        data = sys.stdin.buffer.read()
+
+    try:
+        skipped = decode(data, messages, sys.stdout)
+    except KeyboardInterrupt:
+        return
+    if skipped:
+        sys.stderr.write("%d bytes skipped (unknown tags or IDs)\n" % skipped)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,130 @@
+#!/usr/bin/env python3
+"""Symbolize a PC sampling histogram (Libraries/pc_sampler) into a flat profile.
+
+Dump the sampler state with a debugger while the target is halted, e.g. with gdb:
+
+    dump binary value pcs.bin PCS_sState
+
+then symbolize it against the firmware it was taken from:
+
+    python3 Tools/pc_profile.py pcs.bin --elf build/Debug/SimpleOS.elf
+    python3 Tools/pc_profile.py pcs.bin --map build/Debug/SimpleOS.map
+
+A bucket covering several functions is split between them in proportion to
+their overlap with the bucket, so small functions sharing a bucket get an
+approximate share.
+"""
+
+import argparse
+import bisect
+import re
+import struct
+import subprocess
+import sys
+from collections import defaultdict
+
+MAGIC = 0x31534350
+HEADER = struct.Struct("<9I")
+
+
+def load_histogram(path):
+    with open(path, "rb") as f:
+        data = f.read()
+    if len(data) < HEADER.size:
+        sys.exit("%s: too short for a sampler dump" % path)
+    magic, base, shift, count, samples, outside, saturated, _divider, _enabled = HEADER.unpack_from(data)
+    if magic != MAGIC:
+        sys.exit("%s: bad magic 0x%08x, not a PCS_sState dump" % (path, magic))
+    buckets = struct.unpack_from("<%dH" % count, data, HEADER.size)
+    return base, 1 << shift, buckets, samples, outside, saturated
+
+
+def symbols_from_elf(path, nm):
+    out = subprocess.run([nm, "-S", "-C", "--defined-only", path], check=True,
+                         capture_output=True, text=True).stdout
+    symbols = []
+    for line in out.splitlines():
+        parts = line.split(None, 3)
+        if len(parts) == 4 and parts[2] in "tTwW":
+            addr, size, name = int(parts[0], 16), int(parts[1], 16), parts[3]
+            symbols.append((addr & ~1, size, name))
+    return symbols
+
+
+def symbols_from_map(path):
+    # symbol lines of the output sections: "                0x08000abc                OS_vidUpdateTasks"
+    sym_re = re.compile(r"^\s+0x([0-9a-fA-F]+)\s+([A-Za-z_][\w.]*)\s*$")
+    addresses = {}
+    in_text = False
+    with open(path) as f:
+        for line in f:
+            if line.startswith(".text"):
+                in_text = True
+                continue
+            if in_text and re.match(r"^\.\w", line):
+                in_text = False
+            if in_text:
+                m = sym_re.match(line)
+                if m:
+                    addresses.setdefault(int(m.group(1), 16), m.group(2))
+    ordered = sorted(addresses.items())
+    symbols = []
+    for i, (addr, name) in enumerate(ordered):
+        end = ordered[i + 1][0] if i + 1 < len(ordered) else addr + 4
+        symbols.append((addr, end - addr, name))
+    return symbols
+
+
+def attribute(base, bucket_size, buckets, symbols):
+    symbols = sorted(s for s in symbols if s[1] > 0)
+    starts = [s[0] for s in symbols]
+    profile = defaultdict(float)
+    for idx, hits in enumerate(buckets):
+        if not hits:
+            continue
+        lo = base + idx * bucket_size
+        hi = lo + bucket_size
+        covered = []
+        i = max(bisect.bisect_right(starts, lo) - 1, 0)
+        while i < len(symbols) and symbols[i][0] < hi:
+            addr, size, name = symbols[i]
+            overlap = min(hi, addr + size) - max(lo, addr)
+            if overlap > 0:
+                covered.append((overlap, name))
+            i += 1
+        total = sum(o for o, _ in covered)
+        if not total:
+            profile["?? 0x%08x" % lo] += hits
+            continue
+        for overlap, name in covered:
+            profile[name] += hits * overlap / total
+    return profile
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("dump", help="binary dump of PCS_sState")
+    source = parser.add_mutually_exclusive_group(required=True)
+    source.add_argument("--elf", help="firmware ELF file (uses nm)")
+    source.add_argument("--map", help="firmware linker map file")
+    parser.add_argument("--nm", default="arm-none-eabi-nm", help="nm executable (default: arm-none-eabi-nm)")
+    parser.add_argument("-n", "--top", type=int, default=30, help="number of functions to print (default: 30)")
+    args = parser.parse_args()
+
+    base, bucket_size, buckets, samples, outside, saturated = load_histogram(args.dump)
+    symbols = symbols_from_elf(args.elf, args.nm) if args.elf else symbols_from_map(args.map)
+    profile = attribute(base, bucket_size, buckets, symbols)
+
+    binned = sum(buckets)
+    print("samples: %d, outside code range: %d, saturated: %d, bucket size: %d bytes"
+          % (samples, outside, saturated, bucket_size))
+    if not binned:
+        return
+
+    print("%8s %7s  %s" % ("samples", "%", "function"))
+    for name, hits in sorted(profile.items(), key=lambda kv: -kv[1])[:args.top]:
+        print("%8.1f %6.2f%%  %s" % (hits, 100.0 * hits / binned, name))
+
+
+if __name__ == "__main__":
+    main()
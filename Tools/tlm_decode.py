@@ -0,0 +1,179 @@
+#!/usr/bin/env python3
+"""Decode the telemetry packets of Libraries/telemetry.
+
+Packets are COBS encoded and delimited by a zero byte, see telemetry.h for
+their format. Decode a captured stream, or read it live from a serial port
+(needs pyserial):
+
+    python3 Tools/tlm_decode.py tlm.bin
+    python3 Tools/tlm_decode.py --port /dev/ttyUSB0 --baud 115200 --name 1=load --csv
+
+Packets with a bad CRC or an unknown type are skipped and counted, sequence
+number gaps are reported as dropped packets.
+"""
+
+import argparse
+import sys
+
+PACKET_TYPE = 0x54
+
+
+def cobs_decode(frame):
+    out = bytearray()
+    idx = 0
+    while idx < len(frame):
+        code = frame[idx]
+        if code == 0 or idx + code > len(frame):
+            raise ValueError("bad COBS frame")
+        out += frame[idx + 1:idx + code]
+        idx += code
+        if code < 0xFF and idx < len(frame):
+            out.append(0)
+    return bytes(out)
+
+
+def crc16(data, crc=0xFFFF):
+    """CRC-16/CCITT-FALSE."""
+    for byte in data:
+        crc ^= byte << 8
+        for _ in range(8):
+            crc = ((crc << 1) ^ 0x1021) if crc & 0x8000 else (crc << 1)
+            crc &= 0xFFFF
+    return crc
+
+
+class Reader:
+    def __init__(self, data):
+        self.data = data
+        self.pos = 0
+
+    def byte(self):
+        if self.pos >= len(self.data):
+            raise ValueError("truncated packet")
+        self.pos += 1
+        return self.data[self.pos - 1]
+
+    def leb128(self):
+        value = 0
+        for shift in range(0, 70, 7):
+            byte = self.byte()
+            value |= (byte & 0x7F) << shift
+            if not byte & 0x80:
+                return value
+        raise ValueError("LEB128 value too long")
+
+    def zigzag(self):
+        value = self.leb128()
+        return (value >> 1) ^ -(value & 1)
+
+    def done(self):
+        return self.pos >= len(self.data)
+
+
+def parse_packet(packet):
+    """Return (sequence, update, [(id, count, min, max, mean, std)])."""
+    if len(packet) < 3:
+        raise ValueError("short packet")
+    body, crc = packet[:-2], packet[-2] | (packet[-1] << 8)
+    if crc16(body) != crc:
+        raise ValueError("bad CRC")
+    reader = Reader(body)
+    if reader.byte() != PACKET_TYPE:
+        raise ValueError("unknown packet type")
+    sequence = reader.byte()
+    update = reader.leb128()
+    metrics = []
+    while not reader.done():
+        metric_id = reader.byte()
+        count = reader.leb128()
+        minimum = reader.zigzag()
+        maximum = reader.zigzag()
+        mean = reader.zigzag() / 256.0
+        std = reader.leb128() / 256.0
+        metrics.append((metric_id, count, minimum, maximum, mean, std))
+    return sequence, update, metrics
+
+
+def frames(stream):
+    frame = bytearray()
+    for byte in stream:
+        if byte == 0:
+            if frame:
+                yield bytes(frame)
+            frame = bytearray()
+        else:
+            frame.append(byte)
+
+
+def decode(stream, names, csv, out):
+    """Decode packets from a byte iterator, return (bad packets, dropped packets)."""
+    bad = dropped = 0
+    last = None
+    if csv:
+        out.write("update,metric,count,min,max,mean,std\n")
+    for frame in frames(stream):
+        try:
+            sequence, update, metrics = parse_packet(cobs_decode(frame))
+        except ValueError:
+            bad += 1
+            continue
+        if last is not None and sequence != (last + 1) & 0xFF:
+            gap = (sequence - last - 1) & 0xFF
+            dropped += gap
+            if not csv:
+                out.write("! %u packets dropped\n" % gap)
+        last = sequence
+        for metric_id, count, minimum, maximum, mean, std in metrics:
+            name = names.get(metric_id, "%u" % metric_id)
+            if csv:
+                out.write("%u,%s,%u,%d,%d,%.3f,%.3f\n" % (update, name, count, minimum, maximum, mean, std))
+            else:
+                out.write("[%u] %-12s n=%-6u min=%-8d max=%-8d mean=%-12.3f std=%.3f\n"
+                          % (update, name, count, minimum, maximum, mean, std))
+        out.flush()
+    return bad, dropped
+
+
+def serial_bytes(port, baud):
+    import serial
+    with serial.Serial(port, baud) as link:
+        while True:
+            for byte in link.read(link.in_waiting or 1):
+                yield byte
+
+
+def parse_name(text):
+    metric_id, _, name = text.partition("=")
+    return int(metric_id, 0), name
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("stream", nargs="?", help="captured binary stream (default: stdin)")
+    parser.add_argument("--port", help="read from a serial port instead")
+    parser.add_argument("--baud", type=int, default=115200)
+    parser.add_argument("--name", action="append", type=parse_name, default=[],
+                        metavar="ID=NAME", help="name a metric ID, repeatable")
+    parser.add_argument("--csv", action="store_true", help="print CSV rows")
+    args = parser.parse_args()
+
+    if args.port:
+        data = serial_bytes(args.port, args.baud)
+    elif args.stream:
+        with open(args.stream, "rb") as f:
+            data = f.read()
+    else:
+        data = sys.stdin.buffer.read()
+
+    try:
+        bad, dropped = decode(data, dict(args.name), args.csv, sys.stdout)
+    except KeyboardInterrupt:
+        return
+    if bad:
+        sys.stderr.write("%d bad packets (COBS, CRC or type)\n" % bad)
+    if dropped:
+        sys.stderr.write("%d packets dropped on the target\n" % dropped)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,170 @@
+#!/usr/bin/env python3
+"""Convert a Simple OS trace (simple_os_trace.h) to Perfetto / Chrome trace JSON.
+
+Input is the record byte stream returned by OS_u32TraceRead(), or a raw image
+of OS_sTraceState.buffer dumped by a debugger (use --head / --tail with the
+values of OS_sTraceState.head / tail to linearize it), e.g. with gdb:
+
+    dump binary value trace.bin OS_sTraceState.buffer
+    print OS_sTraceState.head
+    print OS_sTraceState.tail
+
+or a capture of the shell's `trace` command (Libraries/shell), with --hex:
+lines of hexadecimal bytes, other lines (prompt, commands) are ignored.
+
+The output opens in https://ui.perfetto.dev or chrome://tracing. Each task is
+a track (named after its priority), interrupts are on their own tracks.
+"""
+
+import argparse
+import json
+import re
+import sys
+
+EVENT_SHIFT = 5
+ID_MASK = 0x1F
+
+EV_RELEASE = 0
+EV_OVERRUN = 1
+EV_START = 2
+EV_END = 3
+EV_ISR_ENTER = 4
+EV_ISR_EXIT = 5
+EV_LOST = 7
+
+ISR_TICK = 0
+ISR_TID_BASE = 100
+
+HEX_LINE_RE = re.compile(r"^(?:[0-9a-f]{2})+$")
+
+
+def read_leb128(data, pos):
+    value = 0
+    shift = 0
+    while True:
+        if pos >= len(data):
+            raise EOFError
+        byte = data[pos]
+        pos += 1
+        value |= (byte & 0x7F) << shift
+        shift += 7
+        if not byte & 0x80:
+            return value, pos
+
+
+def decode(data):
+    """Yield (event, id, timestamp in cycles, lost count) for each complete record."""
+    pos = 0
+    now = 0
+    while pos < len(data):
+        header = data[pos]
+        try:
+            delta, end = read_leb128(data, pos + 1)
+            lost = 0
+            if (header >> EVENT_SHIFT) == EV_LOST:
+                lost, end = read_leb128(data, end)
+        except EOFError:
+            # truncated last record
+            return
+        now += delta
+        pos = end
+        yield header >> EVENT_SHIFT, header & ID_MASK, now, lost
+
+
+def linearize(image, head, tail):
+    size = len(image)
+    if size & (size - 1):
+        sys.exit("buffer image size must be a power of 2 (OS_TRACE_BUFFER_SIZE)")
+    count = (head - tail) & 0xFFFFFFFF
+    if count > size:
+        sys.exit("head / tail do not match the buffer image")
+    return bytes(image[(tail + i) & (size - 1)] for i in range(count))
+
+
+def convert(data, hz, isr_names):
+    events = []
+    tracks = {}
+    lost_total = 0
+
+    def ts(cycles):
+        return cycles * 1e6 / hz
+
+    def task_tid(prio):
+        tracks.setdefault(prio, "task %d" % prio)
+        return prio
+
+    def isr_tid(isr):
+        tid = ISR_TID_BASE + isr
+        tracks.setdefault(tid, isr_names.get(isr, "ISR %d" % isr))
+        return tid
+
+    for event, ident, cycles, lost in decode(data):
+        base = {"pid": 0, "ts": ts(cycles)}
+        if event == EV_RELEASE:
+            events.append(dict(base, name="release", ph="i", s="t", tid=task_tid(ident)))
+        elif event == EV_OVERRUN:
+            events.append(dict(base, name="overrun", ph="i", s="t", tid=task_tid(ident)))
+        elif event == EV_START:
+            events.append(dict(base, name=tracks.get(ident, "task %d" % ident), ph="B", tid=task_tid(ident)))
+        elif event == EV_END:
+            events.append(dict(base, ph="E", tid=task_tid(ident)))
+        elif event == EV_ISR_ENTER:
+            tid = isr_tid(ident)
+            events.append(dict(base, name=tracks[tid], ph="B", tid=tid))
+        elif event == EV_ISR_EXIT:
+            events.append(dict(base, ph="E", tid=isr_tid(ident)))
+        elif event == EV_LOST:
+            lost_total += lost
+            events.append(dict(base, name="lost %d records" % lost, ph="i", s="g", tid=0))
+
+    for tid, name in sorted(tracks.items()):
+        events.append({"pid": 0, "tid": tid, "ph": "M", "name": "thread_name", "args": {"name": name}})
+        events.append({"pid": 0, "tid": tid, "ph": "M", "name": "thread_sort_index", "args": {"sort_index": tid}})
+    events.append({"pid": 0, "ph": "M", "name": "process_name", "args": {"name": "Simple OS"}})
+
+    return {"traceEvents": events, "displayTimeUnit": "ns"}, lost_total
+
+
+def from_hex(text):
+    lines = text.decode(errors="replace").splitlines()
+    return b"".join(bytes.fromhex(line.strip()) for line in lines if HEX_LINE_RE.match(line.strip()))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("input", help="trace byte stream, or buffer image with --head / --tail")
+    parser.add_argument("-o", "--output", default="-", help="output JSON file (default: stdout)")
+    parser.add_argument("--hz", type=float, default=8e6, help="cycle counter frequency (default: 8 MHz)")
+    parser.add_argument("--head", type=lambda v: int(v, 0), help="OS_sTraceState.head, input is a buffer image")
+    parser.add_argument("--tail", type=lambda v: int(v, 0), default=0, help="OS_sTraceState.tail (default: 0)")
+    parser.add_argument("--isr", action="append", default=[], metavar="ID=NAME", help="name an ISR track")
+    parser.add_argument("--hex", action="store_true", help="input is a capture of the shell's trace command")
+    args = parser.parse_args()
+
+    with open(args.input, "rb") as f:
+        data = f.read()
+
+    if args.hex:
+        data = from_hex(data)
+
+    if args.head is not None:
+        data = linearize(data, args.head, args.tail)
+
+    isr_names = {ISR_TICK: "OS tick"}
+    for item in args.isr:
+        ident, _, name = item.partition("=")
+        isr_names[int(ident, 0)] = name
+
+    trace, lost = convert(data, args.hz, isr_names)
+    if lost:
+        print("warning: %d records were lost (trace buffer full)" % lost, file=sys.stderr)
+
+    if args.output == "-":
+        json.dump(trace, sys.stdout)
+    else:
+        with open(args.output, "w") as f:
+            json.dump(trace, f)
+
+
+if __name__ == "__main__":
+    main()
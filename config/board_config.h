@@ -9,8 +9,13 @@
 #define BOARD_CONFIG_H_
 
 
+#ifndef CONF_OS_TICK_RATE_HZ
 #define CONF_OS_TICK_RATE_HZ    1000
+#endif
+
+#ifndef CONF_OS_TASK_COUNT
 #define CONF_OS_TASK_COUNT      8
+#endif
 
 
 #endif /* BOARD_CONFIG_H_ */
@@ -10,11 +10,11 @@
 #include <stdint.h>
 #include <string.h>
 
-#include <main.h>
-
 #include "utils/utils.h"
 
 #include "simple_os.h"
+#include "simple_os_port.h"
+#include "simple_os_hooks.h"
 
 /* ------------------------------------------------------------------------- */
 
@@ -27,6 +27,11 @@ typedef enum os_flag_t {
                                           Task list was updated, and there may be some tasks ready to be executed  */
 }OS_Flag_t;
 
+/**
+ * @brief Bit index of #OS_FLAG_DISPATCH_RDY, for bit-band access
+ * */
+#define OS_FLAG_DISPATCH_RDY_BIT    1u
+
 /**
  * @brief Task flags, used to set the number of jobs a task has, or if the task is a single shot task.
  * Number of jobs is how many times the task will be executed.
@@ -51,6 +56,9 @@ typedef struct os_task_struct_t {
                                               with lower priority. There can be only one task with a certain priority level.  */
         OS_Task_Flag_t flags;           /**<  Task flags, setting it to #OS_TASK_FLAG_ONESHOT will get the task executed one time,
                                               hen deleted  */
+        uint8_t   suspended;            /**<  Task is suspended, it's not released nor executed until resumed (fits in padding)  */
+        uint8_t   generation;           /**<  Incremented each time a task is added to or deleted from the slot, tells the
+                                              dispatcher if a task deleted or replaced itself while executing (fits in padding)  */
 } OS_Task_Def_t;
 
 /* ------------------------------------------------------------------------- */
@@ -61,9 +69,179 @@ typedef struct os_task_struct_t {
 OS_Task_Def_t OS_asTaskList [OS_TASK_COUNT];
 
 /**
- * Scheduler flags
+ * Scheduler flags (#OS_Flag_t), set by interrupts and cleared by the dispatcher with atomic operations
  * */
-OS_Flag_t OS_enFlags;
+volatile uint32_t OS_u32Flags;
+
+#if OS_USE_BITBAND_READY
+
+#if (OS_TASK_COUNT > 32u)
+#error "Bit-band ready flags support at most 32 tasks (OS_TASK_COUNT)"
+#endif
+
+/**
+ * Ready tasks, bit N is set while the task of priority N has a pending job.
+ * Bits are set and cleared through the bit-band alias.
+ * */
+volatile uint32_t OS_u32ReadyTasks;
+
+/*  releases are single stores to the bit-band alias, they don't mask interrupts  */
+#define OS_RELEASE_ENTER_CRITICAL()
+#define OS_RELEASE_EXIT_CRITICAL()
+
+#else
+
+#define OS_RELEASE_ENTER_CRITICAL()     OS_PORT_ENTER_CRITICAL()
+#define OS_RELEASE_EXIT_CRITICAL()      OS_PORT_EXIT_CRITICAL()
+
+#endif /*  OS_USE_BITBAND_READY  */
+
+#if OS_USE_CYCLES_ACCOUNTING
+
+/**
+ * Update & idle cycles accounting state, shared by the CPU load meter and the overhead accounting
+ * */
+volatile OS_CyclesState_t OS_sCyclesState;
+
+#endif /*  OS_USE_CYCLES_ACCOUNTING  */
+
+/* ------------------------------------------------------------------------- */
+
+/**
+ * @brief Get a task's index in the task list from its handle
+ *
+ * @param [in] xTaskHandle : task handle, got from OS_enAddTask()
+ *
+ * @return Task index, #OS_TASK_COUNT if the handle is not valid
+ * */
+static uint32_t OS_u32TaskIndex(OS_TaskHandle_t xTaskHandle)
+{
+    uint32_t Local_u32TaskIdx;
+
+    /*  task handle is the task's offset in the task list, get task index  */
+    if(((uintptr_t)xTaskHandle % sizeof(OS_Task_Def_t)) != 0)
+    {
+        return OS_TASK_COUNT;
+    }
+
+    Local_u32TaskIdx = (uint32_t)((uintptr_t)xTaskHandle / sizeof(OS_Task_Def_t));
+
+    if(Local_u32TaskIdx >= OS_TASK_COUNT)
+    {
+        return OS_TASK_COUNT;
+    }
+
+    return Local_u32TaskIdx;
+}
+
+/* ------------------------------------------------------------------------- */
+
+/**
+ * @brief Get a task's number of pending jobs (0 or 1 with bit-band ready flags)
+ *
+ * @param [in] u32TaskIdx : task index
+ *
+ * @return Pending jobs
+ * */
+static inline uint32_t OS_u32PendingJobs(uint32_t u32TaskIdx)
+{
+#if OS_USE_BITBAND_READY
+    return OS_PORT_BIT_READ(&OS_u32ReadyTasks, u32TaskIdx);
+#else
+    return OS_asTaskList[u32TaskIdx].flags & OS_TASK_FLAG_MAX_JOBS;
+#endif /*  OS_USE_BITBAND_READY  */
+}
+
+/**
+ * @brief Release a job of a task, called between OS_RELEASE_ENTER_CRITICAL() and OS_RELEASE_EXIT_CRITICAL()
+ *
+ * @param [in] u32TaskIdx : task index
+ *
+ * @return void
+ * */
+static inline void OS_vidReleaseJob(uint32_t u32TaskIdx)
+{
+    /*  with bit-band ready flags, the check isn't atomic with the release, it only selects the hook  */
+    if(OS_u32PendingJobs(u32TaskIdx))
+    {
+        OS_HOOK_TASK_OVERRUN(u32TaskIdx);
+    }
+    else
+    {
+        OS_HOOK_TASK_RELEASE(u32TaskIdx);
+    }
+
+#if OS_USE_BITBAND_READY
+    OS_PORT_BIT_SET(&OS_u32ReadyTasks, u32TaskIdx);
+#else
+    if((OS_asTaskList[u32TaskIdx].flags & OS_TASK_FLAG_MAX_JOBS) != OS_TASK_FLAG_MAX_JOBS)
+    {
+        OS_asTaskList[u32TaskIdx].flags++;
+    }
+#endif /*  OS_USE_BITBAND_READY  */
+}
+
+/**
+ * @brief Discard a task's pending jobs, when the task is added or deleted
+ *
+ * @param [in] u32TaskIdx : task index
+ *
+ * @return void
+ * */
+static inline void OS_vidDiscardJobs(uint32_t u32TaskIdx)
+{
+#if OS_USE_BITBAND_READY
+    OS_PORT_BIT_CLEAR(&OS_u32ReadyTasks, u32TaskIdx);
+#else
+    /*  job counter is reset with the task  */
+    (void)u32TaskIdx;
+#endif /*  OS_USE_BITBAND_READY  */
+}
+
+/**
+ * @brief Delete a task from its slot, the slot's generation is kept and incremented.
+ * Called in a critical section (the tick interrupt reads the slot).
+ *
+ * @param [in] u32TaskIdx : task index
+ *
+ * @return void
+ * */
+static inline void OS_vidClearTask(uint32_t u32TaskIdx)
+{
+    uint8_t Local_u8Generation = OS_asTaskList[u32TaskIdx].generation;
+
+    memset(&OS_asTaskList[u32TaskIdx], 0x00, sizeof(OS_Task_Def_t));
+    OS_asTaskList[u32TaskIdx].generation = Local_u8Generation + 1u;
+    OS_vidDiscardJobs(u32TaskIdx);
+}
+
+/**
+ * @brief Set the dispatch ready flag, interrupts may change the other flags
+ *
+ * @return void
+ * */
+static inline void OS_vidSetDispatchReady(void)
+{
+#if OS_USE_BITBAND_READY
+    OS_PORT_BIT_SET(&OS_u32Flags, OS_FLAG_DISPATCH_RDY_BIT);
+#else
+    OS_PORT_ATOMIC_SET(&OS_u32Flags, OS_FLAG_DISPATCH_RDY);
+#endif /*  OS_USE_BITBAND_READY  */
+}
+
+/**
+ * @brief Clear the dispatch ready flag, interrupts may change the other flags
+ *
+ * @return void
+ * */
+static inline void OS_vidClearDispatchReady(void)
+{
+#if OS_USE_BITBAND_READY
+    OS_PORT_BIT_CLEAR(&OS_u32Flags, OS_FLAG_DISPATCH_RDY_BIT);
+#else
+    OS_PORT_ATOMIC_CLEAR(&OS_u32Flags, OS_FLAG_DISPATCH_RDY);
+#endif /*  OS_USE_BITBAND_READY  */
+}
 
 /* ------------------------------------------------------------------------- */
 
@@ -75,7 +253,10 @@ void OS_vidInitialize(void)
     for(Local_u32TaskIdx = 0; Local_u32TaskIdx < OS_TASK_COUNT; Local_u32TaskIdx++)
     {
         memset(&OS_asTaskList[Local_u32TaskIdx], 0x00, sizeof(OS_Task_Def_t));
+        OS_vidDiscardJobs(Local_u32TaskIdx);
     }
+
+    OS_HOOK_INITIALIZE();
 }
 
 /* ------------------------------------------------------------------------- */
@@ -97,27 +278,78 @@ OS_Error_t OS_enAddTask(OS_vidTaskHandler_t pvHandler, void * const pvArgs, uint
 
 #endif /*  DEBUG  */
 
-    /*  add task to task list  */
-    OS_asTaskList[u32Priority].handler  = pvHandler;
-    OS_asTaskList[u32Priority].period   = u32Period;
-    OS_asTaskList[u32Priority].args     = pvArgs;
-    OS_asTaskList[u32Priority].flags    = OS_TASK_FLAG_NONE;
+    {
+        /*  the tick interrupt must not release a half written task  */
+        OS_PORT_ENTER_CRITICAL();
+
+        /*  add task to task list  */
+        OS_asTaskList[u32Priority].handler  = pvHandler;
+        OS_asTaskList[u32Priority].period   = u32Period;
+        OS_asTaskList[u32Priority].args     = pvArgs;
+        OS_asTaskList[u32Priority].flags    = OS_TASK_FLAG_NONE;
+        OS_asTaskList[u32Priority].suspended = FALSE;
+        OS_asTaskList[u32Priority].generation++;
+        OS_vidDiscardJobs(u32Priority);
+
+        if(IS_ZERO(u32Delay))
+        {
+            OS_asTaskList[u32Priority].delay    = u32Delay;
+        }
+        else
+        {
+            OS_asTaskList[u32Priority].delay    = u32Delay - 1;
+        }
+
+        if(IS_ZERO(u32Period))
+        {
+            OS_asTaskList[u32Priority].flags |= OS_TASK_FLAG_ONESHOT;
+        }
+
+        OS_PORT_EXIT_CRITICAL();
+    }
+
+    /*  pTaskHnadle = address offset of the task in the task list  */
+    (*pTasKHandle) = (OS_TaskHandle_t *)((uint8_t *)&OS_asTaskList[u32Priority] - (uint8_t *)OS_asTaskList);
 
-    if(IS_ZERO(u32Delay))
+    return OS_ERROR_NONE;
+}
+
+/* ------------------------------------------------------------------------- */
+
+OS_Error_t OS_enAddEventTask(OS_vidTaskHandler_t pvHandler, void * const pvArgs, uint32_t u32Priority, OS_TaskHandle_t * pTasKHandle)
+{
+
+#ifdef DEBUG
+
+    if(IS_NULLPTR(pvHandler) | IS_NULLPTR(pTasKHandle))
     {
-        OS_asTaskList[u32Priority].delay    = u32Delay;
+        return OS_ERROR_NULLPTR;
     }
-    else
+
+    if(u32Priority >= OS_TASK_COUNT)
     {
-        OS_asTaskList[u32Priority].delay    = u32Delay - 1;
+        return OS_ERROR_INVALID_PARAM;
     }
 
-    if(IS_ZERO(u32Period))
+#endif /*  DEBUG  */
+
     {
-        OS_asTaskList[u32Priority].flags |= OS_TASK_FLAG_ONESHOT;
+        /*  the tick interrupt must not release a half written task  */
+        OS_PORT_ENTER_CRITICAL();
+
+        /*  event task: no period, and not a one-shot task  */
+        OS_asTaskList[u32Priority].handler  = pvHandler;
+        OS_asTaskList[u32Priority].period   = 0;
+        OS_asTaskList[u32Priority].delay    = (OS_Tick_t)(0u - 1u);
+        OS_asTaskList[u32Priority].args     = pvArgs;
+        OS_asTaskList[u32Priority].flags    = OS_TASK_FLAG_NONE;
+        OS_asTaskList[u32Priority].suspended = FALSE;
+        OS_asTaskList[u32Priority].generation++;
+        OS_vidDiscardJobs(u32Priority);
+
+        OS_PORT_EXIT_CRITICAL();
     }
 
-    /*  pTaskHnadle = address offset of the task in the task list  */
     (*pTasKHandle) = (OS_TaskHandle_t *)((uint8_t *)&OS_asTaskList[u32Priority] - (uint8_t *)OS_asTaskList);
 
     return OS_ERROR_NONE;
@@ -125,20 +357,265 @@ OS_Error_t OS_enAddTask(OS_vidTaskHandler_t pvHandler, void * const pvArgs, uint
 
 /* ------------------------------------------------------------------------- */
 
-OS_Error_t OS_enDeleteTask(OS_TaskHandle_t xTasKHandle)
+OS_Error_t OS_enReadyTask(OS_TaskHandle_t xTasKHandle)
+{
+    uint32_t Local_u32TaskIdx = OS_u32TaskIndex(xTasKHandle);
+
+    if(Local_u32TaskIdx >= OS_TASK_COUNT)
+    {
+        return OS_ERROR_INVALID_PARAM;
+    }
+
+    if(IS_NULLPTR(OS_asTaskList[Local_u32TaskIdx].handler))
+    {
+        return OS_ERROR_INVALID_PARAM;
+    }
+
+    {
+        /*  may be called from interrupts, that preempt the tick or the dispatcher  */
+        OS_RELEASE_ENTER_CRITICAL();
+
+        OS_vidReleaseJob(Local_u32TaskIdx);
+
+        OS_vidSetDispatchReady();
+
+        OS_RELEASE_EXIT_CRITICAL();
+    }
+
+    return OS_ERROR_NONE;
+}
+
+/* ------------------------------------------------------------------------- */
+
+OS_Error_t OS_enReadyTasks(uint32_t u32PriorityMask)
 {
     uint32_t Local_u32TaskIdx;
 
-    /*  get task address  */
-    Local_u32TaskIdx = (uint32_t)((uint8_t *)OS_asTaskList + (uint32_t)xTasKHandle);
+    if((OS_TASK_COUNT < 32u) && (u32PriorityMask >> (OS_TASK_COUNT & 31u)))
+    {
+        return OS_ERROR_INVALID_PARAM;
+    }
+
+    {
+        OS_RELEASE_ENTER_CRITICAL();
+
+        while(u32PriorityMask)
+        {
+            Local_u32TaskIdx = 31u - OS_PORT_CLZ(u32PriorityMask);
+            u32PriorityMask &= ~(1u << Local_u32TaskIdx);
+
+            /*  priorities without a task are skipped  */
+            if(!IS_NULLPTR(OS_asTaskList[Local_u32TaskIdx].handler))
+            {
+                OS_vidReleaseJob(Local_u32TaskIdx);
+            }
+        }
+
+        OS_vidSetDispatchReady();
+
+        OS_RELEASE_EXIT_CRITICAL();
+    }
+
+    return OS_ERROR_NONE;
+}
+
+/* ------------------------------------------------------------------------- */
+
+OS_Error_t OS_enSuspendTask(OS_TaskHandle_t xTasKHandle)
+{
+    uint32_t Local_u32TaskIdx = OS_u32TaskIndex(xTasKHandle);
 
     if(Local_u32TaskIdx >= OS_TASK_COUNT)
     {
         return OS_ERROR_INVALID_PARAM;
     }
 
-    /*  reset task variables  */
-    memset((OS_Task_Def_t*)xTasKHandle, 0x00, sizeof(OS_Task_Def_t));
+    if(IS_NULLPTR(OS_asTaskList[Local_u32TaskIdx].handler))
+    {
+        return OS_ERROR_INVALID_PARAM;
+    }
+
+    OS_asTaskList[Local_u32TaskIdx].suspended = TRUE;
+
+    return OS_ERROR_NONE;
+}
+
+/* ------------------------------------------------------------------------- */
+
+OS_Error_t OS_enResumeTask(OS_TaskHandle_t xTasKHandle)
+{
+    uint32_t Local_u32TaskIdx = OS_u32TaskIndex(xTasKHandle);
+
+    if(Local_u32TaskIdx >= OS_TASK_COUNT)
+    {
+        return OS_ERROR_INVALID_PARAM;
+    }
+
+    if(IS_NULLPTR(OS_asTaskList[Local_u32TaskIdx].handler))
+    {
+        return OS_ERROR_INVALID_PARAM;
+    }
+
+    {
+        OS_PORT_ENTER_CRITICAL();
+
+        OS_asTaskList[Local_u32TaskIdx].suspended = FALSE;
+
+        /*  jobs released before the task was suspended, or by OS_enReadyTask() while suspended  */
+        if(OS_u32PendingJobs(Local_u32TaskIdx))
+        {
+            OS_vidSetDispatchReady();
+        }
+
+        OS_PORT_EXIT_CRITICAL();
+    }
+
+    return OS_ERROR_NONE;
+}
+
+/* ------------------------------------------------------------------------- */
+
+OS_Error_t OS_enSetTaskPeriod(OS_TaskHandle_t xTasKHandle, OS_Tick_t u32Period)
+{
+    uint32_t Local_u32TaskIdx = OS_u32TaskIndex(xTasKHandle);
+
+    if((Local_u32TaskIdx >= OS_TASK_COUNT) || IS_ZERO(u32Period))
+    {
+        return OS_ERROR_INVALID_PARAM;
+    }
+
+    /*  one-shot and event tasks have no period  */
+    if(IS_NULLPTR(OS_asTaskList[Local_u32TaskIdx].handler) || IS_ZERO(OS_asTaskList[Local_u32TaskIdx].period))
+    {
+        return OS_ERROR_INVALID_PARAM;
+    }
+
+    {
+        /*  delay is decremented by OS_vidUpdateTasks() (tick interrupt)  */
+        OS_PORT_ENTER_CRITICAL();
+
+        OS_asTaskList[Local_u32TaskIdx].period = u32Period;
+
+        /*  next release is no later than the new period  */
+        if(OS_asTaskList[Local_u32TaskIdx].delay >= u32Period)
+        {
+            OS_asTaskList[Local_u32TaskIdx].delay = u32Period - 1;
+        }
+
+        OS_PORT_EXIT_CRITICAL();
+    }
+
+    return OS_ERROR_NONE;
+}
+
+/* ------------------------------------------------------------------------- */
+
+OS_Error_t OS_enSetTaskDelay(OS_TaskHandle_t xTasKHandle, OS_Tick_t u32Delay)
+{
+    uint32_t Local_u32TaskIdx = OS_u32TaskIndex(xTasKHandle);
+
+    if(Local_u32TaskIdx >= OS_TASK_COUNT)
+    {
+        return OS_ERROR_INVALID_PARAM;
+    }
+
+    /*  event tasks are not released by ticks  */
+    if(IS_NULLPTR(OS_asTaskList[Local_u32TaskIdx].handler) ||
+       (IS_ZERO(OS_asTaskList[Local_u32TaskIdx].period) && !(OS_asTaskList[Local_u32TaskIdx].flags & OS_TASK_FLAG_ONESHOT)))
+    {
+        return OS_ERROR_INVALID_PARAM;
+    }
+
+    {
+        OS_PORT_ENTER_CRITICAL();
+
+        if(IS_ZERO(u32Delay))
+        {
+            OS_asTaskList[Local_u32TaskIdx].delay = u32Delay;
+        }
+        else
+        {
+            OS_asTaskList[Local_u32TaskIdx].delay = u32Delay - 1;
+        }
+
+        OS_PORT_EXIT_CRITICAL();
+    }
+
+    return OS_ERROR_NONE;
+}
+
+/* ------------------------------------------------------------------------- */
+
+OS_Error_t OS_enGetTaskInfo(uint32_t u32Priority, OS_TaskInfo_t * psInfo)
+{
+    OS_Task_Def_t Local_sTask;
+
+    if(IS_NULLPTR(psInfo))
+    {
+        return OS_ERROR_NULLPTR;
+    }
+
+    if(u32Priority >= OS_TASK_COUNT)
+    {
+        return OS_ERROR_INVALID_PARAM;
+    }
+
+    {
+        /*  consistent snapshot of delay and jobs  */
+        OS_PORT_ENTER_CRITICAL();
+        Local_sTask = OS_asTaskList[u32Priority];
+        OS_PORT_EXIT_CRITICAL();
+    }
+
+    if(IS_NULLPTR(Local_sTask.handler))
+    {
+        return OS_ERROR_INVALID_PARAM;
+    }
+
+    psInfo->handle  = (OS_TaskHandle_t *)((uint8_t *)&OS_asTaskList[u32Priority] - (uint8_t *)OS_asTaskList);
+    psInfo->handler = Local_sTask.handler;
+    psInfo->period  = Local_sTask.period;
+    psInfo->delay   = (OS_Tick_t)(Local_sTask.delay + 1u);
+#if OS_USE_BITBAND_READY
+    psInfo->jobs    = OS_PORT_BIT_READ(&OS_u32ReadyTasks, u32Priority);
+#else
+    psInfo->jobs    = Local_sTask.flags & OS_TASK_FLAG_MAX_JOBS;
+#endif /*  OS_USE_BITBAND_READY  */
+    psInfo->state   = Local_sTask.suspended ? OS_TASK_STATE_SUSPENDED : 0u;
+
+    if(Local_sTask.flags & OS_TASK_FLAG_ONESHOT)
+    {
+        psInfo->state |= OS_TASK_STATE_ONESHOT;
+    }
+    else if(IS_ZERO(Local_sTask.period))
+    {
+        psInfo->state |= OS_TASK_STATE_EVENT;
+        psInfo->delay  = 0;
+    }
+
+    return OS_ERROR_NONE;
+}
+
+/* ------------------------------------------------------------------------- */
+
+OS_Error_t OS_enDeleteTask(OS_TaskHandle_t xTasKHandle)
+{
+    uint32_t Local_u32TaskIdx = OS_u32TaskIndex(xTasKHandle);
+
+    if(Local_u32TaskIdx >= OS_TASK_COUNT)
+    {
+        return OS_ERROR_INVALID_PARAM;
+    }
+
+    {
+        /*  the tick interrupt must not release a half cleared task  */
+        OS_PORT_ENTER_CRITICAL();
+
+        /*  reset task variables  */
+        OS_vidClearTask(Local_u32TaskIdx);
+
+        OS_PORT_EXIT_CRITICAL();
+    }
 
     return OS_ERROR_NONE;
 }
@@ -149,14 +626,16 @@ void OS_vidUpdateTasks(void)
 {
     uint32_t Local_u32Priority;
 
-    /*  clear update ready flag  */
-    OS_enFlags |= OS_FLAG_DISPATCH_RDY;
+    OS_HOOK_UPDATE_ENTER();
+
+    /*  set dispatch ready flag, interrupts calling OS_enReadyTask() may preempt the tick  */
+    OS_vidSetDispatchReady();
 
     /*  update task list  */
     for(Local_u32Priority = 0; Local_u32Priority < OS_TASK_COUNT; Local_u32Priority++)
     {
-        /*  check if no task was added  */
-        if(IS_NULLPTR(OS_asTaskList[Local_u32Priority].handler))
+        /*  check if no task was added, or if the task is suspended  */
+        if(IS_NULLPTR(OS_asTaskList[Local_u32Priority].handler) || OS_asTaskList[Local_u32Priority].suspended)
         {
             continue;
         }
@@ -175,9 +654,21 @@ void OS_vidUpdateTasks(void)
         else
         {
             OS_asTaskList[Local_u32Priority].delay = OS_asTaskList[Local_u32Priority].period - 1;
-            OS_asTaskList[Local_u32Priority].flags++;
+
+            /*  event tasks are only released by OS_enReadyTask()  */
+            if(IS_ZERO(OS_asTaskList[Local_u32Priority].period) && !(OS_asTaskList[Local_u32Priority].flags & OS_TASK_FLAG_ONESHOT))
+            {
+                continue;
+            }
+
+            /*  jobs are also released by interrupts calling OS_enReadyTask(), that may preempt the tick  */
+            OS_RELEASE_ENTER_CRITICAL();
+            OS_vidReleaseJob(Local_u32Priority);
+            OS_RELEASE_EXIT_CRITICAL();
         }
     }
+
+    OS_HOOK_UPDATE_EXIT();
 }
 
 /* ------------------------------------------------------------------------- */
@@ -185,21 +676,84 @@ void OS_vidUpdateTasks(void)
 void OS_vidDispatchTasks(void)
 {
     uint32_t Local_u32Priority;
-
-    /*  check scheduler dispatch ready flag  */
-    if(!(OS_enFlags & OS_FLAG_DISPATCH_RDY))
+    uint8_t Local_u8Generation;
+#if OS_USE_BITBAND_READY
+    uint32_t Local_u32Ready;
+#else
+    uint32_t Local_u32Jobs;
+#endif /*  OS_USE_BITBAND_READY  */
+
+    /*  check scheduler dispatch ready flag, and work left over by the previous pass  */
+    if(!(OS_u32Flags & OS_FLAG_DISPATCH_RDY) && !OS_HOOK_DISPATCH_PENDING())
     {
+        OS_HOOK_DISPATCH_IDLE();
         return;
     }
 
+    OS_HOOK_DISPATCH_START();
+
     /*  clear scheduler's dispatch ready flag  */
-    OS_enFlags &= ~OS_FLAG_DISPATCH_RDY;
+    OS_vidClearDispatchReady();
+
+    OS_HOOK_DISPATCH_TASKS();
+
+#if OS_USE_BITBAND_READY
+
+    /*  execute ready tasks, lowest priority value first  */
+    Local_u32Ready = OS_u32ReadyTasks;
+
+    while(Local_u32Ready)
+    {
+        Local_u32Priority = 31u - OS_PORT_CLZ(Local_u32Ready & (0u - Local_u32Ready));
+
+        /*  ready bit of a deleted task  */
+        if(IS_NULLPTR(OS_asTaskList[Local_u32Priority].handler))
+        {
+            OS_PORT_BIT_CLEAR(&OS_u32ReadyTasks, Local_u32Priority);
+        }
+        /*  pending job is kept while the task is suspended  */
+        else if(!OS_asTaskList[Local_u32Priority].suspended)
+        {
+            /*  jobs released from now on are served by the next execution  */
+            OS_PORT_BIT_CLEAR(&OS_u32ReadyTasks, Local_u32Priority);
+
+            Local_u8Generation = OS_asTaskList[Local_u32Priority].generation;
+
+            OS_HOOK_TASK_START(Local_u32Priority);
+
+            OS_asTaskList[Local_u32Priority].handler(OS_asTaskList[Local_u32Priority].args);
+
+            OS_HOOK_TASK_END(Local_u32Priority);
+
+            /*  only releases are lock-free, the slot is rewritten in a critical section  */
+            if(OS_asTaskList[Local_u32Priority].flags & OS_TASK_FLAG_ONESHOT)
+            {
+                OS_PORT_ENTER_CRITICAL();
+
+                /*  unless the task deleted or replaced itself  */
+                if((OS_asTaskList[Local_u32Priority].generation == Local_u8Generation) &&
+                   (OS_asTaskList[Local_u32Priority].flags & OS_TASK_FLAG_ONESHOT))
+                {
+                    OS_vidClearTask(Local_u32Priority);
+                }
+
+                OS_PORT_EXIT_CRITICAL();
+            }
+
+            OS_HOOK_DISPATCH_TASK(Local_u32Priority);
+        }
+
+        /*  lower priority tasks, including the ones released while this task executed (2 << 31 is 0)  */
+        Local_u32Ready = OS_u32ReadyTasks & (0u - (2u << Local_u32Priority));
+    }
+
+#else
 
     /*  execute tasks  */
     for(Local_u32Priority = 0; Local_u32Priority < OS_TASK_COUNT; Local_u32Priority++)
     {
-        /*  check if no task was added  */
-        if(IS_NULLPTR(OS_asTaskList[Local_u32Priority].handler))
+        /*  check if no task was added, or if the task is suspended (pending jobs are kept)  */
+        if(IS_NULLPTR(OS_asTaskList[Local_u32Priority].handler) || OS_asTaskList[Local_u32Priority].suspended)
         {
             continue;
         }
@@ -207,20 +761,43 @@ void OS_vidDispatchTasks(void)
         /*  check if no task has any pending jobs  */
         if(OS_asTaskList[Local_u32Priority].flags & (OS_TASK_FLAG_MAX_JOBS))
         {
+            /*  jobs pending before execution, all of them are served by this execution  */
+            Local_u32Jobs = OS_asTaskList[Local_u32Priority].flags & OS_TASK_FLAG_MAX_JOBS;
+            Local_u8Generation = OS_asTaskList[Local_u32Priority].generation;
+
+            OS_HOOK_TASK_START(Local_u32Priority);
+
             /*  execute task (call ask handle & pass args)  */
             OS_asTaskList[Local_u32Priority].handler(OS_asTaskList[Local_u32Priority].args);
 
-            /*  check if task is a one-time  */
-            if((OS_asTaskList[Local_u32Priority].flags & OS_TASK_FLAG_ONESHOT))
-            {
-                memset(&OS_asTaskList[Local_u32Priority], 0x00, sizeof(OS_Task_Def_t));
-            }
-            else
+            OS_HOOK_TASK_END(Local_u32Priority);
+
+            OS_PORT_ENTER_CRITICAL();
+
+            /*  a task that deleted or replaced itself (added a task to its slot) has its slot left as is  */
+            if(OS_asTaskList[Local_u32Priority].generation == Local_u8Generation)
             {
-                OS_asTaskList[Local_u32Priority].flags = OS_TASK_FLAG_NONE;
+                /*  check if task is a one-time  */
+                if((OS_asTaskList[Local_u32Priority].flags & OS_TASK_FLAG_ONESHOT))
+                {
+                    OS_vidClearTask(Local_u32Priority);
+                }
+                else
+                {
+                    /*  keep jobs released while the task was executing (OS_enReadyTask() from interrupts)  */
+                    OS_asTaskList[Local_u32Priority].flags -= MIN(Local_u32Jobs, (uint32_t)(OS_asTaskList[Local_u32Priority].flags & OS_TASK_FLAG_MAX_JOBS));
+                }
             }
+
+            OS_PORT_EXIT_CRITICAL();
+
+            OS_HOOK_DISPATCH_TASK(Local_u32Priority);
         }
     }
+
+#endif /*  OS_USE_BITBAND_READY  */
+
+    OS_HOOK_DISPATCH_END();
 }
 
 /* ------------------------------------------------------------------------- */
@@ -14,6 +14,8 @@
 #ifndef __SIMPLE_OS_H__
 #define __SIMPLE_OS_H__
 
+#include <stdint.h>
+
 #include "simple_os_conf.h"
 
 /* ------------------------------------------------------------------------- */
@@ -49,6 +51,7 @@ typedef enum os_error_t {
     OS_ERROR_NONE,              /**<  No error, function execution was successful  */
     OS_ERROR_NULLPTR,           /**<  Null pointer error, function execution failed due to an unexpected NULL pointer  */
     OS_ERROR_INVALID_PARAM,     /**<  Invalid param, function execution failed due to an invalid parameter value  */
+    OS_ERROR_FULL,              /**<  Queue full, function execution failed due to lack of space  */
 }OS_Error_t;
 
 /**
@@ -65,6 +68,25 @@ typedef void * OS_TaskHandle_t;
  * */
 typedef void (* OS_vidTaskHandler_t)(void * const pvArgs);
 
+/**
+ * @brief Task state flags, see #OS_TaskInfo_t
+ * */
+#define OS_TASK_STATE_SUSPENDED     0x01u   /**<  Task is suspended by OS_enSuspendTask()  */
+#define OS_TASK_STATE_ONESHOT       0x02u   /**<  One-shot task, deleted after its execution  */
+#define OS_TASK_STATE_EVENT         0x04u   /**<  Event task, released only by OS_enReadyTask()  */
+
+/**
+ * @brief Task information, read using OS_enGetTaskInfo()
+ * */
+typedef struct os_task_info_t {
+    OS_TaskHandle_t     handle;     /**<  Task handle  */
+    OS_vidTaskHandler_t handler;    /**<  Task's function  */
+    OS_Tick_t           period;     /**<  Task's period in ticks, 0 for one-shot and event tasks  */
+    OS_Tick_t           delay;      /**<  Ticks before the task's next release, 0 for event tasks  */
+    uint32_t            jobs;       /**<  Pending jobs  */
+    uint32_t            state;      /**<  OS_TASK_STATE_xxx flags  */
+} OS_TaskInfo_t;
+
 
 /* ------------------------------------------------------------------------- */
 
@@ -109,6 +131,123 @@ void OS_vidInitialize(void);
  * */
 OS_Error_t OS_enAddTask(OS_vidTaskHandler_t pvHandler, void * const pvArgs, uint32_t u32Priority, OS_Tick_t u32Period, OS_Tick_t u32Delay, OS_TaskHandle_t * pTasKHandle);
 
+/**
+ * @brief Add an event task to OS's task list. Event tasks have no period, they are
+ * executed by the dispatcher once released by OS_enReadyTask().
+ *
+ * @pre OS is initialized using OS_vidInitialize()
+ *
+ * @post Task is added to the task list, and waits for OS_enReadyTask()
+ *
+ * @param [in]  pvHandler   : pointer to task's function `[void, (void *)]`
+ * @param [in]  pvArgs      : pointer to task's function argument, passed to the task's function at execution
+ * @param [in]  u32Priority : task's priority, must be in range `[0: OS_TASK_COUNT - 1]`
+ * @param [out] pTaskHandle : pointer to a task handle variable, used to save the task's handle
+ *
+ * @return #OS_Error_t
+ *              OS_ERROR_NONE           : Task was added successfully to the task list
+ *              OS_ERROR_NULLPTR        : Null error, task was not added to the task list because an unexpected NULL pointer
+ *              OS_ERROR_INVALID_PARAM  : Invalid parameter error, task was not added to the task list because on or more parameters had a wrong value
+ *
+ * */
+OS_Error_t OS_enAddEventTask(OS_vidTaskHandler_t pvHandler, void * const pvArgs, uint32_t u32Priority, OS_TaskHandle_t * pTasKHandle);
+
+/**
+ * @brief Release a task's job, the task is executed at the next OS_vidDispatchTasks() call.
+ * Can be called from interrupts, e.g. to wake up an event task when data is received.
+ * Jobs released while the task is executing are kept, jobs released before the task
+ * is executed are served by a single execution.
+ *
+ * @param [in] xTaskHandle : Task handle (got from OS_enAddTask() or OS_enAddEventTask())
+ *
+ * @return #OS_Error_t
+ *              OS_ERROR_NONE           : Task was released
+ *              OS_ERROR_INVALID_PARAM  : Invalid parameter error, task was not found
+ *
+ * */
+OS_Error_t OS_enReadyTask(OS_TaskHandle_t xTasKHandle);
+
+/**
+ * @brief Release a job of several tasks at once, e.g. all the subscribers of a message.
+ * Same as OS_enReadyTask() for each task, in a single critical section.
+ *
+ * @param [in] u32PriorityMask : tasks priorities, bit N set releases the task of priority N
+ *                               (priorities without a task are skipped)
+ *
+ * @return #OS_Error_t
+ *              OS_ERROR_NONE           : Tasks were released
+ *              OS_ERROR_INVALID_PARAM  : Invalid parameter error, a priority is `>= OS_TASK_COUNT`
+ *
+ * */
+OS_Error_t OS_enReadyTasks(uint32_t u32PriorityMask);
+
+/**
+ * @brief Suspend a task. A suspended task is not released by ticks, and is not executed,
+ * its delay and pending jobs are kept until it's resumed.
+ *
+ * @param [in] xTaskHandle : Task handle (got from OS_enAddTask() or OS_enAddEventTask())
+ *
+ * @return #OS_Error_t
+ *              OS_ERROR_NONE           : Task was suspended
+ *              OS_ERROR_INVALID_PARAM  : Invalid parameter error, task was not found
+ *
+ * */
+OS_Error_t OS_enSuspendTask(OS_TaskHandle_t xTasKHandle);
+
+/**
+ * @brief Resume a suspended task, its pending jobs (if any) are executed at the next
+ * OS_vidDispatchTasks() call.
+ *
+ * @param [in] xTaskHandle : Task handle (got from OS_enAddTask() or OS_enAddEventTask())
+ *
+ * @return #OS_Error_t
+ *              OS_ERROR_NONE           : Task was resumed
+ *              OS_ERROR_INVALID_PARAM  : Invalid parameter error, task was not found
+ *
+ * */
+OS_Error_t OS_enResumeTask(OS_TaskHandle_t xTasKHandle);
+
+/**
+ * @brief Change a periodic task's period. The next release is not delayed past the new period.
+ *
+ * @param [in] xTaskHandle : Task handle (got from OS_enAddTask())
+ * @param [in] u32Period   : new period in OS ticks, `> 0`
+ *
+ * @return #OS_Error_t
+ *              OS_ERROR_NONE           : Period was changed
+ *              OS_ERROR_INVALID_PARAM  : Invalid parameter error, task was not found, is not periodic, or the period is 0
+ *
+ * */
+OS_Error_t OS_enSetTaskPeriod(OS_TaskHandle_t xTasKHandle, OS_Tick_t u32Period);
+
+/**
+ * @brief Change the delay before a task's next release, e.g. to change a periodic task's
+ * phase (offset) relative to other tasks. Same as @p u32Delay of OS_enAddTask().
+ *
+ * @param [in] xTaskHandle : Task handle (got from OS_enAddTask())
+ * @param [in] u32Delay    : ticks before the task's next release
+ *
+ * @return #OS_Error_t
+ *              OS_ERROR_NONE           : Delay was changed
+ *              OS_ERROR_INVALID_PARAM  : Invalid parameter error, task was not found, or is an event task
+ *
+ * */
+OS_Error_t OS_enSetTaskDelay(OS_TaskHandle_t xTasKHandle, OS_Tick_t u32Delay);
+
+/**
+ * @brief Get a task's information
+ *
+ * @param [in]  u32Priority : task's priority, in range `[0: OS_TASK_COUNT - 1]`
+ * @param [out] psInfo      : pointer to a task information structure to fill
+ *
+ * @return #OS_Error_t
+ *              OS_ERROR_NONE           : Task information was read
+ *              OS_ERROR_NULLPTR        : @p psInfo is NULL
+ *              OS_ERROR_INVALID_PARAM  : Invalid parameter error, no task at this priority
+ *
+ * */
+OS_Error_t OS_enGetTaskInfo(uint32_t u32Priority, OS_TaskInfo_t * psInfo);
+
 /**
  * @brief Delete a task from the scheduler
  *
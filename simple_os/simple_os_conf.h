@@ -46,13 +46,170 @@
  * |       16      |      3.5 * 4 = 14     |      2      |     16    |
  * |       32      |      4.5 * 4 = 18     |      2      |     20    |
  *
+ * Define `CONF_OS_USE_16BIT_TICK` as `0` to use 32-bit ticks.
  * */
 #ifdef CONF_OS_USE_16BIT_TICK
+#if (CONF_OS_USE_16BIT_TICK != 0)
 #define OS_USE_16BIT_TICK      CONF_OS_USE_16BIT_TICK
+#endif /*  CONF_OS_USE_16BIT_TICK != 0  */
 #else
 #define OS_USE_16BIT_TICK
 #endif  /*  CONF_OS_USE_16BIT_TICK  */
 
+/**
+ * @brief Most urgent NVIC priority of the interrupts that call Simple OS functions
+ * @details Simple OS critical sections mask interrupts of this priority and lower (BASEPRI),
+ * more urgent interrupts (numerically lower priority) are never masked by Simple OS, and must
+ * not call Simple OS functions. Range is [0: 15] on STM32F1 (4 priority bits), 0 masks all
+ * interrupts (PRIMASK).
+ * */
+#ifdef CONF_OS_MAX_SYSCALL_PRIORITY
+#define OS_MAX_SYSCALL_PRIORITY     CONF_OS_MAX_SYSCALL_PRIORITY
+#else
+#define OS_MAX_SYSCALL_PRIORITY     5u
+#endif  /*  CONF_OS_MAX_SYSCALL_PRIORITY  */
+
+/**
+ * @brief Enable bit-band ready flags
+ * @details When enabled, each task's pending job is a bit of a ready word instead of a job counter,
+ * and the ready bits and the dispatch ready flag are set and cleared through their SRAM bit-band alias:
+ * releases (OS_vidUpdateTasks(), OS_enReadyTask()) are single stores that don't mask interrupts,
+ * and the dispatcher only visits ready tasks, lowest priority value first.
+ * Jobs released before a task is executed are still served by a single execution.
+ *
+ * Requires #OS_TASK_COUNT <= 32.
+ * */
+#ifdef CONF_OS_USE_BITBAND_READY
+#define OS_USE_BITBAND_READY        CONF_OS_USE_BITBAND_READY
+#else
+#define OS_USE_BITBAND_READY        0
+#endif  /*  CONF_OS_USE_BITBAND_READY  */
+
+/**
+ * @brief Enable per-task execution profiling
+ * @details When enabled, the dispatcher measures each task's execution time and
+ * release-to-start latency using the port's cycle counter (DWT cycle counter on target),
+ * and counts task overruns (task released again before its previous job was executed).
+ * Statistics are read using OS_enGetTaskStats(), see simple_os_prof.h.
+ *
+ * Costs sizeof(OS_TaskProf_t) bytes of RAM per task (40 bytes on Cortex-M3).
+ * */
+#ifdef CONF_OS_USE_TASK_PROFILING
+#define OS_USE_TASK_PROFILING       CONF_OS_USE_TASK_PROFILING
+#else
+#define OS_USE_TASK_PROFILING       0
+#endif  /*  CONF_OS_USE_TASK_PROFILING  */
+
+/**
+ * @brief Enable scheduler overhead accounting
+ * @details When enabled, Simple OS measures the cycles spent in OS_vidUpdateTasks(),
+ * in OS_vidDispatchTasks() bookkeeping and in task handlers, and rolls them up
+ * every second into a CPU time breakdown read using OS_enGetOverhead(), see simple_os_overhead.h.
+ * */
+#ifdef CONF_OS_USE_OVERHEAD_ACCOUNTING
+#define OS_USE_OVERHEAD_ACCOUNTING  CONF_OS_USE_OVERHEAD_ACCOUNTING
+#else
+#define OS_USE_OVERHEAD_ACCOUNTING  0
+#endif  /*  CONF_OS_USE_OVERHEAD_ACCOUNTING  */
+
+/**
+ * @brief Enable the CPU load meter
+ * @details When enabled, Simple OS measures idle time between OS_vidDispatchTasks() calls
+ * that find nothing to dispatch, and computes current (100 ms), long term (1 s), peak and
+ * moving average CPU load, read using OS_enGetCpuLoad(), see simple_os_load.h.
+ * */
+#ifdef CONF_OS_USE_CPU_LOAD
+#define OS_USE_CPU_LOAD             CONF_OS_USE_CPU_LOAD
+#else
+#define OS_USE_CPU_LOAD             0
+#endif  /*  CONF_OS_USE_CPU_LOAD  */
+
+/**
+ * @brief Enable per-task latency & response time histograms
+ * @details When enabled, the dispatcher records each task's release-to-start latency and
+ * release-to-end response time into log2-bucketed histograms, read using OS_enGetTaskHistogram(),
+ * see simple_os_hist.h.
+ *
+ * Costs 204 bytes of RAM per task.
+ * */
+#ifdef CONF_OS_USE_TASK_HISTOGRAMS
+#define OS_USE_TASK_HISTOGRAMS      CONF_OS_USE_TASK_HISTOGRAMS
+#else
+#define OS_USE_TASK_HISTOGRAMS      0
+#endif  /*  CONF_OS_USE_TASK_HISTOGRAMS  */
+
+/**
+ * @brief Enable the scheduling event trace recorder
+ * @details When enabled, task release, overrun, start and end events, and tick interrupt
+ * entry / exit are recorded to a RAM ring buffer, read using OS_u32TraceRead(),
+ * see simple_os_trace.h.
+ * */
+#ifdef CONF_OS_USE_TRACE
+#define OS_USE_TRACE                CONF_OS_USE_TRACE
+#else
+#define OS_USE_TRACE                0
+#endif  /*  CONF_OS_USE_TRACE  */
+
+/**
+ * @brief Trace recorder buffer size in bytes, must be a power of 2.
+ * Records are 2 to 3 bytes long for events less than 2 ms apart at 8 MHz.
+ * */
+#ifdef CONF_OS_TRACE_BUFFER_SIZE
+#define OS_TRACE_BUFFER_SIZE        CONF_OS_TRACE_BUFFER_SIZE
+#else
+#define OS_TRACE_BUFFER_SIZE        1024u
+#endif  /*  CONF_OS_TRACE_BUFFER_SIZE  */
+
+/**
+ * @brief Enable deferred function calls
+ * @details When enabled, interrupts post (function, argument) calls using OS_enDeferCall(),
+ * executed by OS_vidDispatchTasks() before and between tasks, see simple_os_defer.h.
+ * */
+#ifdef CONF_OS_USE_DEFERRED_CALLS
+#define OS_USE_DEFERRED_CALLS       CONF_OS_USE_DEFERRED_CALLS
+#else
+#define OS_USE_DEFERRED_CALLS       0
+#endif  /*  CONF_OS_USE_DEFERRED_CALLS  */
+
+/**
+ * @brief Number of deferred calls levels, level 0 is the most urgent
+ * */
+#ifdef CONF_OS_DEFER_LEVELS
+#define OS_DEFER_LEVELS             CONF_OS_DEFER_LEVELS
+#else
+#define OS_DEFER_LEVELS             2u
+#endif  /*  CONF_OS_DEFER_LEVELS  */
+
+/**
+ * @brief Deferred calls queue size, per level, must be a power of 2.
+ * Costs 8 bytes of RAM per call.
+ * */
+#ifdef CONF_OS_DEFER_QUEUE_SIZE
+#define OS_DEFER_QUEUE_SIZE         CONF_OS_DEFER_QUEUE_SIZE
+#else
+#define OS_DEFER_QUEUE_SIZE         8u
+#endif  /*  CONF_OS_DEFER_QUEUE_SIZE  */
+
+/**
+ * @brief Maximum number of deferred calls executed per OS_vidDispatchTasks() pass
+ * */
+#ifdef CONF_OS_DEFER_BUDGET
+#define OS_DEFER_BUDGET             CONF_OS_DEFER_BUDGET
+#else
+#define OS_DEFER_BUDGET             4u
+#endif  /*  CONF_OS_DEFER_BUDGET  */
+
+/**
+ * @brief Enable stackful cooperative threads (Cortex-M3 port only)
+ * @details When enabled, tasks can run threads with their own stack, added by OS_enAddThread(),
+ * switched to and from by PendSV_Handler(), see simple_os_thread.h.
+ * */
+#ifdef CONF_OS_USE_THREADS
+#define OS_USE_THREADS              CONF_OS_USE_THREADS
+#else
+#define OS_USE_THREADS              0
+#endif  /*  CONF_OS_USE_THREADS  */
+
 /**@}*/
 
 #endif /* SIMPLE_OS_CONF_H_ */
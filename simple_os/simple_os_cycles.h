@@ -0,0 +1,124 @@
+/*******************************************************************************
+ * @file    simple_os_cycles.h
+ * @brief   Simple OS update & idle cycles accounting (internal)
+ * @details Free running counters shared by the CPU load meter (simple_os_load.h)
+ *          and the overhead accounting (simple_os_overhead.h), which compute their
+ *          windows from their differences:
+ *          - update : cycles in OS_vidUpdateTasks(), and number of calls (ticks)
+ *          - idle   : cycles between an idle pass of OS_vidDispatchTasks() (nothing
+ *                     to dispatch) and the next call, minus the update cycles in between
+ *
+ *          OS_vidCyclesPoll() is called at every OS_vidDispatchTasks() call, before
+ *          the load meter and overhead hooks, which use its snapshot (poll_*).
+ *          The state is defined in simple_os.c.
+ * @date    18 Oct. 2026
+ * @author  Mohammad Mohsen
+ ******************************************************************************/
+
+#ifndef SIMPLE_OS_CYCLES_H_
+#define SIMPLE_OS_CYCLES_H_
+
+#include "simple_os.h"
+#include "simple_os_port.h"
+
+/* ------------------------------------------------------------------------- */
+
+/**
+ * @addtogroup  simple_os_cycles Simple OS cycles accounting
+ * @{
+ * */
+
+/**
+ * @brief Update & idle cycles are accounted for, used by at least one feature
+ * */
+#if OS_USE_CPU_LOAD || OS_USE_OVERHEAD_ACCOUNTING
+#define OS_USE_CYCLES_ACCOUNTING        1
+#else
+#define OS_USE_CYCLES_ACCOUNTING        0
+#endif
+
+/**
+ * @brief Update & idle cycles accounting state (internal).
+ * All counters are free running.
+ * */
+typedef struct os_cycles_state_t {
+    uint32_t    update_total;       /**<  Cycles in OS_vidUpdateTasks(), written from interrupt context  */
+    uint32_t    ticks;              /**<  Number of OS_vidUpdateTasks() calls, written from interrupt context  */
+    OS_Cycles_t update_start;       /**<  Start of the running OS_vidUpdateTasks()  */
+    uint32_t    idle_total;         /**<  Idle cycles  */
+    OS_Cycles_t poll_last;          /**<  Last call to OS_vidDispatchTasks()  */
+    uint32_t    poll_update;        /**<  update_total at poll_last  */
+    uint32_t    poll_ticks;         /**<  ticks at poll_last  */
+    uint32_t    poll_idle;          /**<  Last call to OS_vidDispatchTasks() was an idle pass  */
+} OS_CyclesState_t;
+
+/* ------------------------------------------------------------------------- */
+
+#if OS_USE_CYCLES_ACCOUNTING
+
+/**
+ * Update & idle cycles accounting state (internal)
+ * */
+extern volatile OS_CyclesState_t OS_sCyclesState;
+
+/**
+ * @brief Called at OS_vidUpdateTasks() entry (internal)
+ * */
+static inline void OS_vidCyclesUpdateEnter(void)
+{
+    OS_sCyclesState.update_start = OS_PORT_GET_CYCLES();
+}
+
+/**
+ * @brief Called at OS_vidUpdateTasks() exit (internal)
+ * */
+static inline void OS_vidCyclesUpdateExit(void)
+{
+    OS_sCyclesState.update_total += OS_PORT_GET_CYCLES() - OS_sCyclesState.update_start;
+    OS_sCyclesState.ticks++;
+}
+
+/**
+ * @brief Called at every OS_vidDispatchTasks() call (internal)
+ *
+ * @param [in] u32Idle : 1 if the call is an idle pass (nothing to dispatch), otherwise 0
+ * */
+static inline void OS_vidCyclesPoll(uint32_t u32Idle)
+{
+    uint32_t Local_u32Ticks;
+    uint32_t Local_u32Update;
+    uint32_t Local_u32Elapsed;
+    uint32_t Local_u32Busy;
+    OS_Cycles_t Local_xNow;
+
+    /*  consistent snapshot: no update ended between reading the counters and the cycle counter  */
+    do
+    {
+        Local_u32Ticks  = OS_sCyclesState.ticks;
+        Local_u32Update = OS_sCyclesState.update_total;
+        Local_xNow = OS_PORT_GET_CYCLES();
+    } while(Local_u32Ticks != OS_sCyclesState.ticks);
+
+    if(OS_sCyclesState.poll_idle)
+    {
+        Local_u32Elapsed = Local_xNow - OS_sCyclesState.poll_last;
+        Local_u32Busy    = Local_u32Update - OS_sCyclesState.poll_update;
+
+        /*  clamped, idle time is never negative  */
+        if(Local_u32Elapsed > Local_u32Busy)
+        {
+            OS_sCyclesState.idle_total += Local_u32Elapsed - Local_u32Busy;
+        }
+    }
+
+    OS_sCyclesState.poll_last   = Local_xNow;
+    OS_sCyclesState.poll_update = Local_u32Update;
+    OS_sCyclesState.poll_ticks  = Local_u32Ticks;
+    OS_sCyclesState.poll_idle   = u32Idle;
+}
+
+#endif /*  OS_USE_CYCLES_ACCOUNTING  */
+
+/**@}*/
+
+#endif /* SIMPLE_OS_CYCLES_H_ */
@@ -0,0 +1,159 @@
+/*******************************************************************************
+ * @file    simple_os_defer.c
+ * @brief   Simple OS deferred function calls
+ * @details Calls queues & dispatch passes, see simple_os_defer.h
+ *
+ *          Queues are changed in short critical sections, a call is popped in a
+ *          critical section then executed with interrupts enabled. The pending mask
+ *          finds the most urgent level with one count leading zeros, whatever the
+ *          number of levels.
+ * @date    18 Oct. 2026
+ * @author  Mohammad Mohsen
+ ******************************************************************************/
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "utils/utils.h"
+
+#include "simple_os_defer.h"
+
+#if OS_USE_DEFERRED_CALLS
+
+/* ------------------------------------------------------------------------- */
+
+/**
+ * Deferred calls state
+ * */
+volatile OS_DeferState_t OS_sDeferState;
+
+/* ------------------------------------------------------------------------- */
+
+/**
+ * @brief Execute posted calls of some levels, most urgent level first, until the pass' budget is exhausted
+ *
+ * @param [in] u32Levels : mask of the levels to execute
+ * */
+static void OS_vidDeferExecute(uint32_t u32Levels)
+{
+    OS_vidDeferredCall_t Local_pfCall;
+    void * Local_pvArg;
+    uint32_t Local_u32Pending;
+    uint32_t Local_u32Level;
+    uint32_t Local_u32Tail;
+
+    while(OS_sDeferState.budget)
+    {
+        OS_PORT_ENTER_CRITICAL();
+
+        Local_u32Pending = OS_sDeferState.pending & u32Levels;
+
+        if(IS_ZERO(Local_u32Pending))
+        {
+            OS_PORT_EXIT_CRITICAL();
+            break;
+        }
+
+        /*  lowest set bit is the most urgent level  */
+        Local_u32Level = 31u - OS_PORT_CLZ(Local_u32Pending & (0u - Local_u32Pending));
+        Local_u32Tail  = OS_sDeferState.tail[Local_u32Level];
+
+        Local_pfCall = OS_sDeferState.queue[Local_u32Level][Local_u32Tail & (OS_DEFER_QUEUE_SIZE - 1)].call;
+        Local_pvArg  = OS_sDeferState.queue[Local_u32Level][Local_u32Tail & (OS_DEFER_QUEUE_SIZE - 1)].arg;
+
+        OS_sDeferState.tail[Local_u32Level] = ++Local_u32Tail;
+
+        if(Local_u32Tail == OS_sDeferState.head[Local_u32Level])
+        {
+            OS_sDeferState.pending &= ~(1u << Local_u32Level);
+        }
+
+        OS_PORT_EXIT_CRITICAL();
+
+        OS_sDeferState.budget--;
+
+        Local_pfCall(Local_pvArg);
+    }
+}
+
+/* ------------------------------------------------------------------------- */
+
+OS_Error_t OS_enDeferCall(OS_vidDeferredCall_t pfCall, void * pvArg, uint32_t u32Level)
+{
+    uint32_t Local_u32Head;
+
+    if(IS_NULLPTR(pfCall))
+    {
+        return OS_ERROR_NULLPTR;
+    }
+
+    if(u32Level >= OS_DEFER_LEVELS)
+    {
+        return OS_ERROR_INVALID_PARAM;
+    }
+
+    OS_PORT_ENTER_CRITICAL();
+
+    Local_u32Head = OS_sDeferState.head[u32Level];
+
+    if((Local_u32Head - OS_sDeferState.tail[u32Level]) >= OS_DEFER_QUEUE_SIZE)
+    {
+        OS_sDeferState.dropped++;
+        OS_PORT_EXIT_CRITICAL();
+        return OS_ERROR_FULL;
+    }
+
+    OS_sDeferState.queue[u32Level][Local_u32Head & (OS_DEFER_QUEUE_SIZE - 1)].call = pfCall;
+    OS_sDeferState.queue[u32Level][Local_u32Head & (OS_DEFER_QUEUE_SIZE - 1)].arg  = pvArg;
+
+    OS_sDeferState.head[u32Level] = Local_u32Head + 1u;
+    OS_sDeferState.pending |= 1u << u32Level;
+
+    OS_PORT_EXIT_CRITICAL();
+
+    return OS_ERROR_NONE;
+}
+
+/* ------------------------------------------------------------------------- */
+
+uint32_t OS_u32DeferDropped(void)
+{
+    uint32_t Local_u32Dropped;
+
+    OS_PORT_ENTER_CRITICAL();
+    Local_u32Dropped = OS_sDeferState.dropped;
+    OS_sDeferState.dropped = 0;
+    OS_PORT_EXIT_CRITICAL();
+
+    return Local_u32Dropped;
+}
+
+/* ------------------------------------------------------------------------- */
+
+void OS_vidDeferReset(void)
+{
+    OS_PORT_ENTER_CRITICAL();
+    memset((void *)&OS_sDeferState, 0x00, sizeof(OS_sDeferState));
+    OS_PORT_EXIT_CRITICAL();
+}
+
+/* ------------------------------------------------------------------------- */
+
+void OS_vidDeferDispatchStart(void)
+{
+    OS_sDeferState.budget = OS_DEFER_BUDGET;
+
+    OS_vidDeferExecute(UINT32_MAX);
+}
+
+/* ------------------------------------------------------------------------- */
+
+void OS_vidDeferDispatchTask(void)
+{
+    OS_vidDeferExecute(0x01u);
+}
+
+/* ------------------------------------------------------------------------- */
+
+#endif /*  OS_USE_DEFERRED_CALLS  */
@@ -0,0 +1,139 @@
+/*******************************************************************************
+ * @file    simple_os_defer.h
+ * @brief   Simple OS deferred function calls
+ * @details Optional (#OS_USE_DEFERRED_CALLS) queue of (function, argument) calls,
+ *          posted by interrupts and executed by OS_vidDispatchTasks(), so that an
+ *          interrupt handler only does the urgent part of its work, and defers the
+ *          rest (bottom half) to the main loop, without a dedicated task:
+ *
+ *          @code
+ *          void USART1_IRQHandler(void)
+ *          {
+ *              ...
+ *              OS_enDeferCall(vidParseFrame, &frame, 0);
+ *          }
+ *          @endcode
+ *
+ *          Calls are posted to one of #OS_DEFER_LEVELS levels, level 0 being the most
+ *          urgent. Each level is a ring of #OS_DEFER_QUEUE_SIZE calls, executed in post order.
+ *          A dispatch pass executes at most #OS_DEFER_BUDGET calls, so a burst of calls
+ *          doesn't delay periodic tasks:
+ *          - before tasks are dispatched : calls of all levels, most urgent level first
+ *          - after each executed task    : calls of level 0 only
+ *
+ *          Calls left over by a pass (budget exhausted) are executed by the next
+ *          OS_vidDispatchTasks() call, even if no task was released.
+ *          Calls are executed with interrupts enabled, and must not block.
+ * @date    18 Oct. 2026
+ * @author  Mohammad Mohsen
+ ******************************************************************************/
+
+#ifndef SIMPLE_OS_DEFER_H_
+#define SIMPLE_OS_DEFER_H_
+
+#include "simple_os.h"
+#include "simple_os_port.h"
+
+/* ------------------------------------------------------------------------- */
+
+/**
+ * @addtogroup  simple_os_defer Simple OS deferred function calls
+ * @{
+ * */
+
+/**
+ * @brief Deferred function, called by OS_vidDispatchTasks() with the posted argument
+ * */
+typedef void (*OS_vidDeferredCall_t)(void * pvArg);
+
+/**
+ * @brief Deferred call, as stored in the queues (internal)
+ * */
+typedef struct os_deferred_t {
+    OS_vidDeferredCall_t    call;   /**<  Function  */
+    void *                  arg;    /**<  Argument passed to the function  */
+} OS_Deferred_t;
+
+/* ------------------------------------------------------------------------- */
+
+#if OS_USE_DEFERRED_CALLS
+
+#if (OS_DEFER_QUEUE_SIZE & (OS_DEFER_QUEUE_SIZE - 1))
+#error "OS_DEFER_QUEUE_SIZE must be a power of 2"
+#endif
+
+#if (OS_DEFER_LEVELS == 0) || (OS_DEFER_LEVELS > 32)
+#error "OS_DEFER_LEVELS must be in range [1: 32]"
+#endif
+
+/**
+ * @brief Deferred calls state (internal)
+ * */
+typedef struct os_defer_state_t {
+    OS_Deferred_t   queue [OS_DEFER_LEVELS][OS_DEFER_QUEUE_SIZE];   /**<  Calls rings, per level  */
+    uint32_t        head [OS_DEFER_LEVELS];     /**<  Post index, free running  */
+    uint32_t        tail [OS_DEFER_LEVELS];     /**<  Execute index, free running  */
+    uint32_t        pending;                    /**<  Mask of the levels that have calls  */
+    uint32_t        budget;                     /**<  Calls left to execute in the current dispatch pass  */
+    uint32_t        dropped;                    /**<  Calls dropped (level full)  */
+} OS_DeferState_t;
+
+/**
+ * Deferred calls state (internal)
+ * */
+extern volatile OS_DeferState_t OS_sDeferState;
+
+/**
+ * @brief Post a deferred call. Can be called from interrupts.
+ *
+ * @param [in] pfCall   : function to call
+ * @param [in] pvArg    : argument passed to @p pfCall
+ * @param [in] u32Level : level, [0: #OS_DEFER_LEVELS - 1], 0 is the most urgent
+ *
+ * @return #OS_Error_t
+ *              OS_ERROR_NONE           : Call was posted
+ *              OS_ERROR_NULLPTR        : @p pfCall is NULL
+ *              OS_ERROR_INVALID_PARAM  : @p u32Level is out of range
+ *              OS_ERROR_FULL           : Level's queue is full, call was dropped
+ * */
+OS_Error_t OS_enDeferCall(OS_vidDeferredCall_t pfCall, void * pvArg, uint32_t u32Level);
+
+/**
+ * @brief Get (and reset) the number of calls dropped because their level's queue was full
+ *
+ * @param void
+ *
+ * @return Dropped calls since the last call
+ * */
+uint32_t OS_u32DeferDropped(void);
+
+/**
+ * @brief Discard all posted calls, called by OS_vidInitialize() (internal)
+ * */
+void OS_vidDeferReset(void);
+
+/**
+ * @brief Start a dispatch pass: renew the calls budget, and execute calls of all levels (internal)
+ * */
+void OS_vidDeferDispatchStart(void);
+
+/**
+ * @brief Execute calls of level 0, within the pass' remaining budget, called after each task (internal)
+ * */
+void OS_vidDeferDispatchTask(void);
+
+/* ------------------------------------------------------------------------- */
+
+/**
+ * @brief Check if some calls are posted, called by OS_vidDispatchTasks() (internal)
+ * */
+static inline uint32_t OS_u32DeferPending(void)
+{
+    return OS_sDeferState.pending;
+}
+
+#endif /*  OS_USE_DEFERRED_CALLS  */
+
+/**@}*/
+
+#endif /* SIMPLE_OS_DEFER_H_ */
@@ -0,0 +1,125 @@
+/*******************************************************************************
+ * @file    simple_os_hist.c
+ * @brief   Simple OS per-task latency & response time histograms
+ * @details Histograms and query API, see simple_os_hist.h
+ * @date    18 Oct. 2026
+ * @author  Mohammad Mohsen
+ ******************************************************************************/
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "utils/utils.h"
+
+#include "simple_os_hist.h"
+
+#if OS_USE_TASK_HISTOGRAMS
+
+/* ------------------------------------------------------------------------- */
+
+/**
+ * Histograms, indexed by task priority
+ * */
+OS_TaskHist_t OS_asTaskHist [OS_TASK_COUNT];
+
+/**
+ * Cycle count at each task's oldest pending release, indexed by task priority
+ * */
+OS_Cycles_t OS_axHistRelease [OS_TASK_COUNT];
+
+/* ------------------------------------------------------------------------- */
+
+void OS_vidResetAllTaskHistograms(void)
+{
+    uint32_t Local_u32Priority;
+
+    for(Local_u32Priority = 0; Local_u32Priority < OS_TASK_COUNT; Local_u32Priority++)
+    {
+        memset(&OS_asTaskHist[Local_u32Priority], 0x00, sizeof(OS_TaskHist_t));
+    }
+}
+
+/* ------------------------------------------------------------------------- */
+
+OS_Error_t OS_enGetTaskHistogram(uint32_t u32Priority, OS_TaskHist_t * psHist)
+{
+    if(IS_NULLPTR(psHist))
+    {
+        return OS_ERROR_NULLPTR;
+    }
+
+    if(u32Priority >= OS_TASK_COUNT)
+    {
+        return OS_ERROR_INVALID_PARAM;
+    }
+
+    /*  histograms are only written from OS_vidDispatchTasks(), in the same context as the caller  */
+    *psHist = OS_asTaskHist[u32Priority];
+
+    return OS_ERROR_NONE;
+}
+
+/* ------------------------------------------------------------------------- */
+
+OS_Error_t OS_enResetTaskHistogram(uint32_t u32Priority)
+{
+    if(u32Priority >= OS_TASK_COUNT)
+    {
+        return OS_ERROR_INVALID_PARAM;
+    }
+
+    memset(&OS_asTaskHist[u32Priority], 0x00, sizeof(OS_TaskHist_t));
+
+    return OS_ERROR_NONE;
+}
+
+/* ------------------------------------------------------------------------- */
+
+uint32_t OS_u32HistogramPercentile(const uint32_t * pu32Buckets, uint32_t u32Permille)
+{
+    uint64_t Local_u64Total = 0;
+    uint64_t Local_u64Rank;
+    uint64_t Local_u64Count = 0;
+    uint32_t Local_u32Bucket;
+
+    if(IS_NULLPTR(pu32Buckets))
+    {
+        return 0;
+    }
+
+    for(Local_u32Bucket = 0; Local_u32Bucket < OS_HIST_BUCKET_COUNT; Local_u32Bucket++)
+    {
+        Local_u64Total += pu32Buckets[Local_u32Bucket];
+    }
+
+    if(IS_ZERO(Local_u64Total))
+    {
+        return 0;
+    }
+
+    /*  rank of the percentile sample, rounded up: ceil(total * permille / 1000)  */
+    Local_u64Rank = ((Local_u64Total * u32Permille) + 999u) / 1000u;
+
+    if(IS_ZERO(Local_u64Rank))
+    {
+        Local_u64Rank = 1;
+    }
+
+    for(Local_u32Bucket = 0; Local_u32Bucket < (OS_HIST_BUCKET_COUNT - 1u); Local_u32Bucket++)
+    {
+        Local_u64Count += pu32Buckets[Local_u32Bucket];
+
+        if(Local_u64Count >= Local_u64Rank)
+        {
+            /*  bucket n holds [2 ^ (n - 1), 2 ^ n), its largest value is 2 ^ n - 1  */
+            return (1u << Local_u32Bucket) - 1u;
+        }
+    }
+
+    return UINT32_MAX;
+}
+
+/* ------------------------------------------------------------------------- */
+
+#endif /*  OS_USE_TASK_HISTOGRAMS  */
@@ -0,0 +1,161 @@
+/*******************************************************************************
+ * @file    simple_os_hist.h
+ * @brief   Simple OS per-task latency & response time histograms
+ * @details Optional histograms (#OS_USE_TASK_HISTOGRAMS) of each task's:
+ *          - latency       : release (OS_vidUpdateTasks()) to start of the task's handler
+ *          - response time : release to end of the task's handler
+ *
+ *          Histograms have #OS_HIST_BUCKET_COUNT log2 buckets of cycles of the
+ *          port's cycle counter: bucket 0 counts 0 cycles, bucket n counts
+ *          [2 ^ (n - 1), 2 ^ n) cycles, the last bucket also counts all larger values.
+ *          Each event costs one count leading zeros and one increment.
+ *
+ *          On overrun (task released while its previous job is pending), times are
+ *          measured from the oldest pending release.
+ * @date    18 Oct. 2026
+ * @author  Mohammad Mohsen
+ ******************************************************************************/
+
+#ifndef SIMPLE_OS_HIST_H_
+#define SIMPLE_OS_HIST_H_
+
+#include "simple_os.h"
+#include "simple_os_port.h"
+
+/* ------------------------------------------------------------------------- */
+
+/**
+ * @addtogroup  simple_os_hist Simple OS task histograms
+ * @{
+ * */
+
+/**
+ * @brief Number of log2 buckets, the last bucket starts at 2 ^ 22 cycles (~0.5 s at 8 MHz)
+ * */
+#define OS_HIST_BUCKET_COUNT            24u
+
+/**
+ * @brief Task histograms, as returned by OS_enGetTaskHistogram()
+ * */
+typedef struct os_task_hist_t {
+    uint32_t    latency [OS_HIST_BUCKET_COUNT];     /**<  Release-to-start latency histogram  */
+    uint32_t    response [OS_HIST_BUCKET_COUNT];    /**<  Release-to-end response time histogram  */
+    uint32_t    latency_max;                        /**<  Maximum latency (cycles)  */
+    uint32_t    response_max;                       /**<  Maximum response time (cycles)  */
+} OS_TaskHist_t;
+
+/* ------------------------------------------------------------------------- */
+
+#if OS_USE_TASK_HISTOGRAMS
+
+/**
+ * Histograms, indexed by task priority (internal)
+ * */
+extern OS_TaskHist_t OS_asTaskHist [OS_TASK_COUNT];
+
+/**
+ * Cycle count at each task's oldest pending release, indexed by task priority (internal)
+ * */
+extern OS_Cycles_t OS_axHistRelease [OS_TASK_COUNT];
+
+/**
+ * @brief Reset all tasks' histograms
+ *
+ * @param void
+ *
+ * @return void
+ * */
+void OS_vidResetAllTaskHistograms(void);
+
+/**
+ * @brief Get a snapshot of a task's histograms
+ *
+ * @param [in]  u32Priority : task's priority (task list index)
+ * @param [out] psHist      : pointer to a histograms structure to fill
+ *
+ * @return #OS_Error_t
+ *              OS_ERROR_NONE           : Histograms were copied to @p psHist
+ *              OS_ERROR_NULLPTR        : @p psHist is NULL
+ *              OS_ERROR_INVALID_PARAM  : @p u32Priority is out of range
+ * */
+OS_Error_t OS_enGetTaskHistogram(uint32_t u32Priority, OS_TaskHist_t * psHist);
+
+/**
+ * @brief Reset a task's histograms
+ *
+ * @param [in] u32Priority : task's priority (task list index)
+ *
+ * @return #OS_Error_t
+ *              OS_ERROR_NONE           : Histograms were reset
+ *              OS_ERROR_INVALID_PARAM  : @p u32Priority is out of range
+ * */
+OS_Error_t OS_enResetTaskHistogram(uint32_t u32Priority);
+
+/**
+ * @brief Get a percentile of a histogram, as the upper bound of the bucket that contains it
+ *
+ * @param [in] pu32Buckets  : histogram (#OS_HIST_BUCKET_COUNT buckets)
+ * @param [in] u32Permille  : percentile in permille, e.g. 500 for p50, 990 for p99
+ *
+ * @return Upper bound (cycles) of the percentile's bucket, 0 if the histogram is empty.
+ *         UINT32_MAX if the percentile falls in the last (open ended) bucket.
+ * */
+uint32_t OS_u32HistogramPercentile(const uint32_t * pu32Buckets, uint32_t u32Permille);
+
+/* ------------------------------------------------------------------------- */
+
+/**
+ * @brief Get a value's bucket (internal)
+ * */
+static inline uint32_t OS_u32HistBucket(uint32_t u32Value)
+{
+    uint32_t Local_u32Bucket = 32u - OS_PORT_CLZ(u32Value);
+
+    return (Local_u32Bucket < OS_HIST_BUCKET_COUNT) ? Local_u32Bucket : (OS_HIST_BUCKET_COUNT - 1u);
+}
+
+/**
+ * @brief Record a task's release, called by OS_vidUpdateTasks() (internal)
+ * */
+static inline void OS_vidHistTaskRelease(uint32_t u32Priority)
+{
+    OS_axHistRelease[u32Priority] = OS_PORT_GET_CYCLES();
+}
+
+/**
+ * @brief Record the start of a task's execution, called by OS_vidDispatchTasks() (internal)
+ * */
+static inline void OS_vidHistTaskStart(uint32_t u32Priority)
+{
+    OS_TaskHist_t * Local_psHist = &OS_asTaskHist[u32Priority];
+    uint32_t Local_u32Latency = OS_PORT_GET_CYCLES() - OS_axHistRelease[u32Priority];
+
+    Local_psHist->latency[OS_u32HistBucket(Local_u32Latency)]++;
+
+    if(Local_u32Latency > Local_psHist->latency_max)
+    {
+        Local_psHist->latency_max = Local_u32Latency;
+    }
+}
+
+/**
+ * @brief Record the end of a task's execution, called by OS_vidDispatchTasks() (internal)
+ * */
+static inline void OS_vidHistTaskEnd(uint32_t u32Priority)
+{
+    OS_TaskHist_t * Local_psHist = &OS_asTaskHist[u32Priority];
+    uint32_t Local_u32Response = OS_PORT_GET_CYCLES() - OS_axHistRelease[u32Priority];
+
+    Local_psHist->response[OS_u32HistBucket(Local_u32Response)]++;
+
+    if(Local_u32Response > Local_psHist->response_max)
+    {
+        Local_psHist->response_max = Local_u32Response;
+    }
+}
+
+#endif /*  OS_USE_TASK_HISTOGRAMS  */
+
+/**@}*/
+
+#endif /* SIMPLE_OS_HIST_H_ */
@@ -0,0 +1,267 @@
+/*******************************************************************************
+ * @file    simple_os_hooks.h
+ * @brief   Simple OS instrumentation hooks (internal)
+ * @details Hook points called by the scheduler (simple_os.c). Each hook expands
+ *          to the calls of the enabled optional features, or to nothing.
+ *          This file must only be included by simple_os.c.
+ * @date    18 Oct. 2026
+ * @author  Mohammad Mohsen
+ ******************************************************************************/
+
+#ifndef SIMPLE_OS_HOOKS_H_
+#define SIMPLE_OS_HOOKS_H_
+
+#include "simple_os_conf.h"
+#include "simple_os_port.h"
+
+#include "simple_os_cycles.h"
+
+#if OS_USE_TASK_PROFILING
+#include "simple_os_prof.h"
+#endif /*  OS_USE_TASK_PROFILING  */
+
+#if OS_USE_OVERHEAD_ACCOUNTING
+#include "simple_os_overhead.h"
+#endif /*  OS_USE_OVERHEAD_ACCOUNTING  */
+
+#if OS_USE_CPU_LOAD
+#include "simple_os_load.h"
+#endif /*  OS_USE_CPU_LOAD  */
+
+#if OS_USE_TRACE
+#include "simple_os_trace.h"
+#endif /*  OS_USE_TRACE  */
+
+#if OS_USE_TASK_HISTOGRAMS
+#include "simple_os_hist.h"
+#endif /*  OS_USE_TASK_HISTOGRAMS  */
+
+#if OS_USE_DEFERRED_CALLS
+#include "simple_os_defer.h"
+#endif /*  OS_USE_DEFERRED_CALLS  */
+
+/* ------------------------------------------------------------------------- */
+
+/**
+ * @brief Cycle counter is used by at least one feature
+ * */
+#if OS_USE_TASK_PROFILING || OS_USE_OVERHEAD_ACCOUNTING || OS_USE_CPU_LOAD || OS_USE_TRACE || \
+    OS_USE_TASK_HISTOGRAMS
+#define OS_USE_CYCLE_COUNTER        1
+#else
+#define OS_USE_CYCLE_COUNTER        0
+#endif
+
+/* ------------------------------------------------------------------------- */
+
+#if OS_USE_CYCLE_COUNTER
+#define OS_HOOK_INIT_CYCLES()                   OS_PORT_INIT_CYCLES()
+#else
+#define OS_HOOK_INIT_CYCLES()
+#endif /*  OS_USE_CYCLE_COUNTER  */
+
+#if OS_USE_TASK_PROFILING
+#define OS_HOOK_PROF_INITIALIZE()               OS_vidResetAllTaskStats()
+#define OS_HOOK_PROF_TASK_RELEASE(prio)         OS_vidProfTaskRelease(prio)
+#define OS_HOOK_PROF_TASK_OVERRUN(prio)         OS_vidProfTaskOverrun(prio)
+#define OS_HOOK_PROF_TASK_START(prio)           OS_vidProfTaskStart(prio)
+#define OS_HOOK_PROF_TASK_END(prio)             OS_vidProfTaskEnd(prio)
+#else
+#define OS_HOOK_PROF_INITIALIZE()
+#define OS_HOOK_PROF_TASK_RELEASE(prio)
+#define OS_HOOK_PROF_TASK_OVERRUN(prio)
+#define OS_HOOK_PROF_TASK_START(prio)
+#define OS_HOOK_PROF_TASK_END(prio)
+#endif /*  OS_USE_TASK_PROFILING  */
+
+#if OS_USE_CYCLES_ACCOUNTING
+#define OS_HOOK_CYCLES_UPDATE_ENTER()           OS_vidCyclesUpdateEnter()
+#define OS_HOOK_CYCLES_UPDATE_EXIT()            OS_vidCyclesUpdateExit()
+#define OS_HOOK_CYCLES_DISPATCH_IDLE()          OS_vidCyclesPoll(1u)
+#define OS_HOOK_CYCLES_DISPATCH_START()         OS_vidCyclesPoll(0u)
+#else
+#define OS_HOOK_CYCLES_UPDATE_ENTER()
+#define OS_HOOK_CYCLES_UPDATE_EXIT()
+#define OS_HOOK_CYCLES_DISPATCH_IDLE()
+#define OS_HOOK_CYCLES_DISPATCH_START()
+#endif /*  OS_USE_CYCLES_ACCOUNTING  */
+
+#if OS_USE_OVERHEAD_ACCOUNTING
+#define OS_HOOK_OVH_INITIALIZE()                OS_vidResetOverhead()
+#define OS_HOOK_OVH_DISPATCH_START()            OS_vidOverheadDispatchStart()
+#define OS_HOOK_OVH_DISPATCH_END()              OS_vidOverheadDispatchEnd()
+#define OS_HOOK_OVH_TASK_START(prio)            OS_vidOverheadTaskStart()
+#define OS_HOOK_OVH_TASK_END(prio)              OS_vidOverheadTaskEnd()
+#else
+#define OS_HOOK_OVH_INITIALIZE()
+#define OS_HOOK_OVH_DISPATCH_START()
+#define OS_HOOK_OVH_DISPATCH_END()
+#define OS_HOOK_OVH_TASK_START(prio)
+#define OS_HOOK_OVH_TASK_END(prio)
+#endif /*  OS_USE_OVERHEAD_ACCOUNTING  */
+
+#if OS_USE_CPU_LOAD
+#define OS_HOOK_LOAD_INITIALIZE()               OS_vidResetCpuLoad()
+#define OS_HOOK_LOAD_DISPATCH_IDLE()            OS_vidLoadPoll()
+#define OS_HOOK_LOAD_DISPATCH_START()           OS_vidLoadPoll()
+#else
+#define OS_HOOK_LOAD_INITIALIZE()
+#define OS_HOOK_LOAD_DISPATCH_IDLE()
+#define OS_HOOK_LOAD_DISPATCH_START()
+#endif /*  OS_USE_CPU_LOAD  */
+
+#if OS_USE_TRACE
+#define OS_HOOK_TRACE_INITIALIZE()              OS_vidTraceReset()
+#define OS_HOOK_TRACE_UPDATE_ENTER()            OS_vidTraceIsrEnter(OS_TRACE_ISR_TICK)
+#define OS_HOOK_TRACE_UPDATE_EXIT()             OS_vidTraceIsrExit(OS_TRACE_ISR_TICK)
+#define OS_HOOK_TRACE_TASK_RELEASE(prio)        OS_vidTraceRecord(OS_TRACE_EVENT_RELEASE, (prio))
+#define OS_HOOK_TRACE_TASK_OVERRUN(prio)        OS_vidTraceRecord(OS_TRACE_EVENT_OVERRUN, (prio))
+#define OS_HOOK_TRACE_TASK_START(prio)          OS_vidTraceRecord(OS_TRACE_EVENT_START, (prio))
+#define OS_HOOK_TRACE_TASK_END(prio)            OS_vidTraceRecord(OS_TRACE_EVENT_END, (prio))
+#else
+#define OS_HOOK_TRACE_INITIALIZE()
+#define OS_HOOK_TRACE_UPDATE_ENTER()
+#define OS_HOOK_TRACE_UPDATE_EXIT()
+#define OS_HOOK_TRACE_TASK_RELEASE(prio)
+#define OS_HOOK_TRACE_TASK_OVERRUN(prio)
+#define OS_HOOK_TRACE_TASK_START(prio)
+#define OS_HOOK_TRACE_TASK_END(prio)
+#endif /*  OS_USE_TRACE  */
+
+#if OS_USE_TASK_HISTOGRAMS
+#define OS_HOOK_HIST_INITIALIZE()               OS_vidResetAllTaskHistograms()
+#define OS_HOOK_HIST_TASK_RELEASE(prio)         OS_vidHistTaskRelease(prio)
+#define OS_HOOK_HIST_TASK_START(prio)           OS_vidHistTaskStart(prio)
+#define OS_HOOK_HIST_TASK_END(prio)             OS_vidHistTaskEnd(prio)
+#else
+#define OS_HOOK_HIST_INITIALIZE()
+#define OS_HOOK_HIST_TASK_RELEASE(prio)
+#define OS_HOOK_HIST_TASK_START(prio)
+#define OS_HOOK_HIST_TASK_END(prio)
+#endif /*  OS_USE_TASK_HISTOGRAMS  */
+
+#if OS_USE_DEFERRED_CALLS
+#define OS_HOOK_DEFER_INITIALIZE()              OS_vidDeferReset()
+#define OS_HOOK_DEFER_PENDING()                 OS_u32DeferPending()
+#define OS_HOOK_DEFER_DISPATCH_START()          OS_vidDeferDispatchStart()
+#define OS_HOOK_DEFER_DISPATCH_TASK(prio)       OS_vidDeferDispatchTask()
+#else
+#define OS_HOOK_DEFER_INITIALIZE()
+#define OS_HOOK_DEFER_PENDING()                 0u
+#define OS_HOOK_DEFER_DISPATCH_START()
+#define OS_HOOK_DEFER_DISPATCH_TASK(prio)
+#endif /*  OS_USE_DEFERRED_CALLS  */
+
+/* ------------------------------------------------------------------------- */
+
+/**
+ * @brief Called by OS_vidInitialize(), after the task list is reset
+ * */
+#define OS_HOOK_INITIALIZE()            do {                                    \
+                                            OS_HOOK_INIT_CYCLES();              \
+                                            OS_HOOK_PROF_INITIALIZE();          \
+                                            OS_HOOK_OVH_INITIALIZE();           \
+                                            OS_HOOK_LOAD_INITIALIZE();          \
+                                            OS_HOOK_TRACE_INITIALIZE();         \
+                                            OS_HOOK_HIST_INITIALIZE();          \
+                                            OS_HOOK_DEFER_INITIALIZE();         \
+                                        } while(0)
+
+/**
+ * @brief Called at OS_vidUpdateTasks() entry
+ * */
+#define OS_HOOK_UPDATE_ENTER()          do {                                    \
+                                            OS_HOOK_TRACE_UPDATE_ENTER();       \
+                                            OS_HOOK_CYCLES_UPDATE_ENTER();      \
+                                        } while(0)
+
+/**
+ * @brief Called at OS_vidUpdateTasks() exit
+ * */
+#define OS_HOOK_UPDATE_EXIT()           do {                                    \
+                                            OS_HOOK_CYCLES_UPDATE_EXIT();       \
+                                            OS_HOOK_TRACE_UPDATE_EXIT();        \
+                                        } while(0)
+
+/**
+ * @brief Evaluated by OS_vidDispatchTasks() when the dispatch ready flag is not set,
+ * non zero if there's work to dispatch anyway
+ * */
+#define OS_HOOK_DISPATCH_PENDING()      (OS_HOOK_DEFER_PENDING())
+
+/**
+ * @brief Called by OS_vidDispatchTasks() when there's nothing to dispatch (idle pass)
+ * */
+#define OS_HOOK_DISPATCH_IDLE()         do {                                    \
+                                            OS_HOOK_CYCLES_DISPATCH_IDLE();     \
+                                            OS_HOOK_LOAD_DISPATCH_IDLE();       \
+                                        } while(0)
+
+/**
+ * @brief Called by OS_vidDispatchTasks() when the dispatch ready flag is set, before tasks are dispatched
+ * */
+#define OS_HOOK_DISPATCH_START()        do {                                    \
+                                            OS_HOOK_CYCLES_DISPATCH_START();    \
+                                            OS_HOOK_LOAD_DISPATCH_START();      \
+                                            OS_HOOK_OVH_DISPATCH_START();       \
+                                        } while(0)
+
+/**
+ * @brief Called by OS_vidDispatchTasks() after the dispatch ready flag is cleared, before tasks are dispatched
+ * */
+#define OS_HOOK_DISPATCH_TASKS()        do {                                    \
+                                            OS_HOOK_DEFER_DISPATCH_START();     \
+                                        } while(0)
+
+/**
+ * @brief Called by OS_vidDispatchTasks() after a task is executed and its jobs are updated
+ * */
+#define OS_HOOK_DISPATCH_TASK(prio)     do {                                    \
+                                            OS_HOOK_DEFER_DISPATCH_TASK(prio);  \
+                                        } while(0)
+
+/**
+ * @brief Called by OS_vidDispatchTasks() after ready tasks are dispatched
+ * */
+#define OS_HOOK_DISPATCH_END()          do {                                    \
+                                            OS_HOOK_OVH_DISPATCH_END();         \
+                                        } while(0)
+
+/**
+ * @brief Called by OS_vidUpdateTasks() or OS_enReadyTask() when a task is released (its first pending job)
+ * */
+#define OS_HOOK_TASK_RELEASE(prio)      do {                                    \
+                                            OS_HOOK_PROF_TASK_RELEASE(prio);    \
+                                            OS_HOOK_TRACE_TASK_RELEASE(prio);   \
+                                            OS_HOOK_HIST_TASK_RELEASE(prio);    \
+                                        } while(0)
+
+/**
+ * @brief Called by OS_vidUpdateTasks() or OS_enReadyTask() when a task is released while its previous job is still pending
+ * */
+#define OS_HOOK_TASK_OVERRUN(prio)      do {                                    \
+                                            OS_HOOK_PROF_TASK_OVERRUN(prio);    \
+                                            OS_HOOK_TRACE_TASK_OVERRUN(prio);   \
+                                        } while(0)
+
+/**
+ * @brief Called by OS_vidDispatchTasks() before a task's handler is called
+ * */
+#define OS_HOOK_TASK_START(prio)        do {                                    \
+                                            OS_HOOK_TRACE_TASK_START(prio);     \
+                                            OS_HOOK_HIST_TASK_START(prio);      \
+                                            OS_HOOK_PROF_TASK_START(prio);      \
+                                            OS_HOOK_OVH_TASK_START(prio);       \
+                                        } while(0)
+
+/**
+ * @brief Called by OS_vidDispatchTasks() after a task's handler returns
+ * */
+#define OS_HOOK_TASK_END(prio)          do {                                    \
+                                            OS_HOOK_OVH_TASK_END(prio);         \
+                                            OS_HOOK_PROF_TASK_END(prio);        \
+                                            OS_HOOK_HIST_TASK_END(prio);        \
+                                            OS_HOOK_TRACE_TASK_END(prio);       \
+                                        } while(0)
+
+#endif /* SIMPLE_OS_HOOKS_H_ */
@@ -0,0 +1,127 @@
+/*******************************************************************************
+ * @file    simple_os_load.c
+ * @brief   Simple OS CPU load meter
+ * @details Window computation and query API, see simple_os_load.h
+ * @date    18 Oct. 2026
+ * @author  Mohammad Mohsen
+ ******************************************************************************/
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "utils/utils.h"
+
+#include "simple_os_load.h"
+
+#if OS_USE_CPU_LOAD
+
+/* ------------------------------------------------------------------------- */
+
+/**
+ * CPU load meter state
+ * */
+volatile OS_LoadState_t OS_sLoadState;
+
+/**
+ * Last computed load values
+ * */
+static OS_CpuLoad_t OS_sCpuLoad;
+
+/* ------------------------------------------------------------------------- */
+
+/**
+ * @brief Compute load (permille) from window length and idle time
+ * */
+static uint16_t OS_u16LoadPermille(uint64_t u64Total, uint64_t u64Idle)
+{
+    if(IS_ZERO(u64Total))
+    {
+        return 0;
+    }
+
+    if(u64Idle >= u64Total)
+    {
+        return 0;
+    }
+
+    return (uint16_t)(1000u - (uint32_t)((u64Idle * 1000u) / u64Total));
+}
+
+/* ------------------------------------------------------------------------- */
+
+void OS_vidResetCpuLoad(void)
+{
+    /*  idle total is only written from OS_vidDispatchTasks(), in the same context as the caller  */
+    OS_sLoadState.window_start  = OS_PORT_GET_CYCLES();
+    OS_sLoadState.window_idle   = OS_sCyclesState.idle_total;
+    OS_sLoadState.long_windows  = 0;
+    OS_sLoadState.long_total    = 0;
+    OS_sLoadState.long_idle     = 0;
+    OS_sLoadState.ewma_q        = 0;
+
+    memset(&OS_sCpuLoad, 0x00, sizeof(OS_CpuLoad_t));
+}
+
+/* ------------------------------------------------------------------------- */
+
+void OS_vidResetCpuLoadPeak(void)
+{
+    OS_sCpuLoad.peak = OS_sCpuLoad.current;
+}
+
+/* ------------------------------------------------------------------------- */
+
+void OS_vidLoadWindow(OS_Cycles_t xNow)
+{
+    uint32_t Local_u32Total = xNow - OS_sLoadState.window_start;
+    uint32_t Local_u32Idle  = OS_sCyclesState.idle_total - OS_sLoadState.window_idle;
+
+    /*  short window  */
+    OS_sCpuLoad.current = OS_u16LoadPermille(Local_u32Total, Local_u32Idle);
+
+    if(OS_sCpuLoad.current > OS_sCpuLoad.peak)
+    {
+        OS_sCpuLoad.peak = OS_sCpuLoad.current;
+    }
+
+    /*  ewma_q += current - ewma  */
+    OS_sLoadState.ewma_q = OS_sLoadState.ewma_q + OS_sCpuLoad.current - (OS_sLoadState.ewma_q >> OS_CPU_LOAD_EWMA_SHIFT);
+    OS_sCpuLoad.ewma = (uint16_t)(OS_sLoadState.ewma_q >> OS_CPU_LOAD_EWMA_SHIFT);
+
+    /*  long window  */
+    OS_sLoadState.long_total += Local_u32Total;
+    OS_sLoadState.long_idle  += Local_u32Idle;
+    OS_sLoadState.long_windows++;
+
+    if(OS_sLoadState.long_windows >= OS_CPU_LOAD_LONG_WINDOWS)
+    {
+        OS_sCpuLoad.longterm = OS_u16LoadPermille(OS_sLoadState.long_total, OS_sLoadState.long_idle);
+
+        OS_sLoadState.long_windows  = 0;
+        OS_sLoadState.long_total    = 0;
+        OS_sLoadState.long_idle     = 0;
+    }
+
+    OS_sLoadState.window_start  = xNow;
+    OS_sLoadState.window_idle   = OS_sCyclesState.idle_total;
+}
+
+/* ------------------------------------------------------------------------- */
+
+OS_Error_t OS_enGetCpuLoad(OS_CpuLoad_t * psLoad)
+{
+    if(IS_NULLPTR(psLoad))
+    {
+        return OS_ERROR_NULLPTR;
+    }
+
+    /*  load is only written from OS_vidDispatchTasks(), in the same context as the caller  */
+    *psLoad = OS_sCpuLoad;
+
+    return OS_ERROR_NONE;
+}
+
+/* ------------------------------------------------------------------------- */
+
+#endif /*  OS_USE_CPU_LOAD  */
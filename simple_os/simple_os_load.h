@@ -0,0 +1,134 @@
+/*******************************************************************************
+ * @file    simple_os_load.h
+ * @brief   Simple OS CPU load meter
+ * @details Optional CPU load meter (#OS_USE_CPU_LOAD) based on idle time accounting.
+ *          OS_vidDispatchTasks() is called in a loop by the application, a call that
+ *          finds nothing to dispatch is an idle pass. The time between an idle pass
+ *          and the next call to OS_vidDispatchTasks() is idle time, minus the time
+ *          spent in OS_vidUpdateTasks() in between (simple_os_cycles.h).
+ *
+ *          Load is the non-idle fraction of a window, in permille [0: 1000]:
+ *          - current : last 100 ms window (#OS_CPU_LOAD_WINDOW_MS)
+ *          - long    : last 1 s window (10 short windows)
+ *          - peak    : highest short window load since the last OS_vidResetCpuLoadPeak()
+ *          - ewma    : exponentially weighted moving average of short windows,
+ *                      weight 1/(2 ^ #OS_CPU_LOAD_EWMA_SHIFT)
+ *
+ *          Windows are closed by OS_vidDispatchTasks(), so a task running longer
+ *          than a window extends it.
+ * @date    18 Oct. 2026
+ * @author  Mohammad Mohsen
+ ******************************************************************************/
+
+#ifndef SIMPLE_OS_LOAD_H_
+#define SIMPLE_OS_LOAD_H_
+
+#include "simple_os.h"
+#include "simple_os_port.h"
+#include "simple_os_cycles.h"
+
+/* ------------------------------------------------------------------------- */
+
+/**
+ * @addtogroup  simple_os_load Simple OS CPU load meter
+ * @{
+ * */
+
+/**
+ * @brief Short load window, in milliseconds
+ * */
+#define OS_CPU_LOAD_WINDOW_MS           100u
+
+/**
+ * @brief Number of short windows in a long window
+ * */
+#define OS_CPU_LOAD_LONG_WINDOWS        10u
+
+/**
+ * @brief EWMA weight of the newest short window: 1 / (2 ^ OS_CPU_LOAD_EWMA_SHIFT)
+ * */
+#define OS_CPU_LOAD_EWMA_SHIFT          3u
+
+/**
+ * @brief CPU load, in permille [0: 1000]
+ * */
+typedef struct os_cpu_load_t {
+    uint16_t    current;            /**<  Load of the last short window  */
+    uint16_t    longterm;           /**<  Load of the last long window  */
+    uint16_t    peak;               /**<  Highest short window load  */
+    uint16_t    ewma;               /**<  Moving average of short windows load  */
+} OS_CpuLoad_t;
+
+/**
+ * @brief CPU load meter state (internal)
+ * */
+typedef struct os_load_state_t {
+    OS_Cycles_t window_start;       /**<  Start of the current short window  */
+    uint32_t    window_idle;        /**<  Idle cycles (OS_CyclesState_t::idle_total) at the current short window start  */
+    uint32_t    long_windows;       /**<  Short windows in the current long window  */
+    uint64_t    long_total;         /**<  Cycles in the current long window  */
+    uint64_t    long_idle;          /**<  Idle cycles in the current long window  */
+    uint32_t    ewma_q;             /**<  EWMA, permille << OS_CPU_LOAD_EWMA_SHIFT  */
+} OS_LoadState_t;
+
+/* ------------------------------------------------------------------------- */
+
+#if OS_USE_CPU_LOAD
+
+/**
+ * CPU load meter state (internal)
+ * */
+extern volatile OS_LoadState_t OS_sLoadState;
+
+/**
+ * @brief Reset the CPU load meter
+ *
+ * @param void
+ *
+ * @return void
+ * */
+void OS_vidResetCpuLoad(void);
+
+/**
+ * @brief Reset the peak CPU load
+ *
+ * @param void
+ *
+ * @return void
+ * */
+void OS_vidResetCpuLoadPeak(void);
+
+/**
+ * @brief Get CPU load
+ *
+ * @param [out] psLoad : pointer to a load structure to fill
+ *
+ * @return #OS_Error_t
+ *              OS_ERROR_NONE       : Load was copied to @p psLoad
+ *              OS_ERROR_NULLPTR    : @p psLoad is NULL
+ * */
+OS_Error_t OS_enGetCpuLoad(OS_CpuLoad_t * psLoad);
+
+/**
+ * @brief Close the current short window (internal)
+ * */
+void OS_vidLoadWindow(OS_Cycles_t xNow);
+
+/* ------------------------------------------------------------------------- */
+
+/**
+ * @brief Called at every OS_vidDispatchTasks() call, after OS_vidCyclesPoll() (internal)
+ * */
+static inline void OS_vidLoadPoll(void)
+{
+    if((OS_sCyclesState.poll_last - OS_sLoadState.window_start) >= ((OS_PORT_CYCLES_PER_SEC / 1000u) * OS_CPU_LOAD_WINDOW_MS))
+    {
+        OS_vidLoadWindow(OS_sCyclesState.poll_last);
+    }
+}
+
+#endif /*  OS_USE_CPU_LOAD  */
+
+/**@}*/
+
+#endif /* SIMPLE_OS_LOAD_H_ */
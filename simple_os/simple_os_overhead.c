@@ -0,0 +1,104 @@
+/*******************************************************************************
+ * @file    simple_os_overhead.c
+ * @brief   Simple OS scheduler overhead accounting
+ * @details Window rollup and query API, see simple_os_overhead.h
+ * @date    18 Oct. 2026
+ * @author  Mohammad Mohsen
+ ******************************************************************************/
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "utils/utils.h"
+
+#include "simple_os_overhead.h"
+
+#if OS_USE_OVERHEAD_ACCOUNTING
+
+/* ------------------------------------------------------------------------- */
+
+/**
+ * Overhead accounting state
+ * */
+volatile OS_OverheadState_t OS_sOverheadState;
+
+/**
+ * Last completed window
+ * */
+static OS_Overhead_t OS_sOverheadWindow;
+
+/* ------------------------------------------------------------------------- */
+
+void OS_vidResetOverhead(void)
+{
+    OS_PORT_ENTER_CRITICAL();
+    OS_sOverheadState.window_start      = OS_PORT_GET_CYCLES();
+    OS_sOverheadState.window_update     = OS_sCyclesState.update_total;
+    OS_sOverheadState.window_ticks      = OS_sCyclesState.ticks;
+    OS_PORT_EXIT_CRITICAL();
+
+    OS_sOverheadState.window_dispatch   = OS_sOverheadState.dispatch_total;
+    OS_sOverheadState.window_task       = OS_sOverheadState.task_total;
+    OS_sOverheadState.window_idle       = OS_sCyclesState.idle_total;
+
+    memset(&OS_sOverheadWindow, 0x00, sizeof(OS_Overhead_t));
+}
+
+/* ------------------------------------------------------------------------- */
+
+void OS_vidOverheadRollup(void)
+{
+    OS_Cycles_t Local_xNow;
+    uint32_t Local_u32Update;
+    uint32_t Local_u32Ticks;
+    uint32_t Local_u32Dispatch;
+    uint32_t Local_u32Tasks;
+    uint32_t Local_u32Idle;
+    uint32_t Local_u32Used;
+
+    /*  consistent snapshot of the update counters, taken by OS_vidCyclesPoll()  */
+    Local_xNow      = OS_sCyclesState.poll_last;
+    Local_u32Update = OS_sCyclesState.poll_update;
+    Local_u32Ticks  = OS_sCyclesState.poll_ticks;
+
+    Local_u32Dispatch   = OS_sOverheadState.dispatch_total;
+    Local_u32Tasks      = OS_sOverheadState.task_total;
+    Local_u32Idle       = OS_sCyclesState.idle_total;
+
+    OS_sOverheadWindow.total    = Local_xNow - OS_sOverheadState.window_start;
+    OS_sOverheadWindow.update   = Local_u32Update - OS_sOverheadState.window_update;
+    OS_sOverheadWindow.tasks    = Local_u32Tasks - OS_sOverheadState.window_task;
+    OS_sOverheadWindow.dispatch = (Local_u32Dispatch - OS_sOverheadState.window_dispatch) - OS_sOverheadWindow.tasks;
+    OS_sOverheadWindow.idle     = Local_u32Idle - OS_sOverheadState.window_idle;
+    OS_sOverheadWindow.ticks    = Local_u32Ticks - OS_sOverheadState.window_ticks;
+
+    Local_u32Used = OS_sOverheadWindow.update + OS_sOverheadWindow.dispatch + OS_sOverheadWindow.tasks + OS_sOverheadWindow.idle;
+    OS_sOverheadWindow.unaccounted = (OS_sOverheadWindow.total > Local_u32Used) ? (OS_sOverheadWindow.total - Local_u32Used) : 0;
+
+    OS_sOverheadState.window_start      = Local_xNow;
+    OS_sOverheadState.window_update     = Local_u32Update;
+    OS_sOverheadState.window_dispatch   = Local_u32Dispatch;
+    OS_sOverheadState.window_task       = Local_u32Tasks;
+    OS_sOverheadState.window_idle       = Local_u32Idle;
+    OS_sOverheadState.window_ticks      = Local_u32Ticks;
+}
+
+/* ------------------------------------------------------------------------- */
+
+OS_Error_t OS_enGetOverhead(OS_Overhead_t * psOverhead)
+{
+    if(IS_NULLPTR(psOverhead))
+    {
+        return OS_ERROR_NULLPTR;
+    }
+
+    /*  window is only written from OS_vidDispatchTasks(), in the same context as the caller  */
+    *psOverhead = OS_sOverheadWindow;
+
+    return OS_ERROR_NONE;
+}
+
+/* ------------------------------------------------------------------------- */
+
+#endif /*  OS_USE_OVERHEAD_ACCOUNTING  */
@@ -0,0 +1,156 @@
+/*******************************************************************************
+ * @file    simple_os_overhead.h
+ * @brief   Simple OS scheduler overhead accounting
+ * @details Optional accounting (#OS_USE_OVERHEAD_ACCOUNTING) of the cycles
+ *          consumed by Simple OS itself versus application tasks:
+ *          - update      : OS_vidUpdateTasks() (called from the tick interrupt)
+ *          - dispatch    : OS_vidDispatchTasks() bookkeeping, excluding task handlers
+ *          - tasks       : task handlers
+ *          - idle        : from an idle pass of OS_vidDispatchTasks() (nothing to dispatch)
+ *                          to the next call, the same idle time as the CPU load meter
+ *          - unaccounted : everything else, not measured, e.g. the application's loop
+ *                          between OS_vidDispatchTasks() calls after tasks were dispatched
+ *
+ *          Cycles spent in OS_vidUpdateTasks() while a task, the dispatcher or idle
+ *          polling is running are only counted as update cycles. Update and idle
+ *          cycles are shared with the CPU load meter (simple_os_cycles.h).
+ *          Exception entry/exit and other interrupts are not accounted for, and are
+ *          counted where they occur.
+ *
+ *          Counters are rolled up every second (#OS_TICK_RATE_HZ ticks), the last
+ *          completed second is read using OS_enGetOverhead().
+ * @date    18 Oct. 2026
+ * @author  Mohammad Mohsen
+ ******************************************************************************/
+
+#ifndef SIMPLE_OS_OVERHEAD_H_
+#define SIMPLE_OS_OVERHEAD_H_
+
+#include "simple_os.h"
+#include "simple_os_port.h"
+#include "simple_os_cycles.h"
+
+/* ------------------------------------------------------------------------- */
+
+/**
+ * @addtogroup  simple_os_overhead Simple OS overhead accounting
+ * @{
+ * */
+
+/**
+ * @brief CPU time breakdown of a 1 second window, in cycles.
+ * `total = update + dispatch + tasks + idle + unaccounted`
+ * */
+typedef struct os_overhead_t {
+    uint32_t    total;              /**<  Window length  */
+    uint32_t    update;             /**<  Cycles in OS_vidUpdateTasks()  */
+    uint32_t    dispatch;           /**<  Cycles in OS_vidDispatchTasks(), excluding task handlers  */
+    uint32_t    tasks;              /**<  Cycles in task handlers  */
+    uint32_t    idle;               /**<  Idle cycles  */
+    uint32_t    unaccounted;        /**<  Remaining cycles  */
+    uint32_t    ticks;              /**<  OS ticks in the window  */
+} OS_Overhead_t;
+
+/**
+ * @brief Overhead accounting state (internal).
+ * All counters are free running, windows are computed from their differences,
+ * and those of #OS_CyclesState_t.
+ * */
+typedef struct os_overhead_state_t {
+    uint32_t    dispatch_total;     /**<  Cycles in OS_vidDispatchTasks(), including task handlers  */
+    uint32_t    task_total;         /**<  Cycles in task handlers  */
+    OS_Cycles_t dispatch_start;     /**<  Start of the running OS_vidDispatchTasks()  */
+    uint32_t    dispatch_update;    /**<  update_total at dispatch_start  */
+    OS_Cycles_t task_start;         /**<  Start of the running task  */
+    uint32_t    task_update;        /**<  update_total at task_start  */
+    OS_Cycles_t window_start;       /**<  Start of the current window  */
+    uint32_t    window_update;      /**<  update_total at window start  */
+    uint32_t    window_dispatch;    /**<  dispatch_total at window start  */
+    uint32_t    window_task;        /**<  task_total at window start  */
+    uint32_t    window_idle;        /**<  idle_total at window start  */
+    uint32_t    window_ticks;       /**<  ticks at window start  */
+} OS_OverheadState_t;
+
+/* ------------------------------------------------------------------------- */
+
+#if OS_USE_OVERHEAD_ACCOUNTING
+
+/**
+ * Overhead accounting state (internal)
+ * */
+extern volatile OS_OverheadState_t OS_sOverheadState;
+
+/**
+ * @brief Reset overhead accounting, starts a new window
+ *
+ * @param void
+ *
+ * @return void
+ * */
+void OS_vidResetOverhead(void);
+
+/**
+ * @brief Get the CPU time breakdown of the last completed 1 second window
+ *
+ * @param [out] psOverhead : pointer to a breakdown structure to fill.
+ *                           All fields are 0 until the first window is completed.
+ *
+ * @return #OS_Error_t
+ *              OS_ERROR_NONE       : Breakdown was copied to @p psOverhead
+ *              OS_ERROR_NULLPTR    : @p psOverhead is NULL
+ * */
+OS_Error_t OS_enGetOverhead(OS_Overhead_t * psOverhead);
+
+/**
+ * @brief Close the current window at the last OS_vidDispatchTasks() call, and start a new one (internal)
+ * */
+void OS_vidOverheadRollup(void);
+
+/* ------------------------------------------------------------------------- */
+
+/**
+ * @brief Called by OS_vidDispatchTasks() when tasks are about to be dispatched, after OS_vidCyclesPoll() (internal)
+ * */
+static inline void OS_vidOverheadDispatchStart(void)
+{
+    if((OS_sCyclesState.poll_ticks - OS_sOverheadState.window_ticks) >= OS_TICK_RATE_HZ)
+    {
+        OS_vidOverheadRollup();
+    }
+
+    OS_sOverheadState.dispatch_update   = OS_sCyclesState.poll_update;
+    OS_sOverheadState.dispatch_start    = OS_sCyclesState.poll_last;
+}
+
+/**
+ * @brief Called by OS_vidDispatchTasks() after all ready tasks were executed (internal)
+ * */
+static inline void OS_vidOverheadDispatchEnd(void)
+{
+    OS_sOverheadState.dispatch_total += (OS_PORT_GET_CYCLES() - OS_sOverheadState.dispatch_start)
+                                      - (OS_sCyclesState.update_total - OS_sOverheadState.dispatch_update);
+}
+
+/**
+ * @brief Called by OS_vidDispatchTasks() before a task's handler is called (internal)
+ * */
+static inline void OS_vidOverheadTaskStart(void)
+{
+    OS_sOverheadState.task_update   = OS_sCyclesState.update_total;
+    OS_sOverheadState.task_start    = OS_PORT_GET_CYCLES();
+}
+
+/**
+ * @brief Called by OS_vidDispatchTasks() after a task's handler returns (internal)
+ * */
+static inline void OS_vidOverheadTaskEnd(void)
+{
+    OS_sOverheadState.task_total += (OS_PORT_GET_CYCLES() - OS_sOverheadState.task_start)
+                                  - (OS_sCyclesState.update_total - OS_sOverheadState.task_update);
+}
+
+#endif /*  OS_USE_OVERHEAD_ACCOUNTING  */
+
+/**@}*/
+
+#endif /* SIMPLE_OS_OVERHEAD_H_ */
@@ -0,0 +1,193 @@
+/*******************************************************************************
+ * @file    simple_os_port.h
+ * @brief   Simple OS port layer
+ * @details Target specific services used by Simple OS and its optional features:
+ *          a free running cycle counter, critical sections and atomic bit operations.
+ *          - Cortex-M3 (default): DWT cycle counter, BASEPRI critical sections
+ *            (PRIMASK if #OS_MAX_SYSCALL_PRIORITY is 0), LDREX / STREX atomics,
+ *            single bit access through the SRAM bit-band alias region.
+ *          - Host (#OS_PORT_HOST defined): monotonic clock in nanoseconds,
+ *            no critical sections (single threaded).
+ *
+ *          BASEPRI critical sections only mask interrupts whose priority is
+ *          #OS_MAX_SYSCALL_PRIORITY or lower (numerically greater or equal). More urgent
+ *          interrupts keep their latency while the scheduler's state is changed,
+ *          and must not call Simple OS functions.
+ * @date    18 Oct. 2026
+ * @author  Mohammad Mohsen
+ ******************************************************************************/
+
+#ifndef SIMPLE_OS_PORT_H_
+#define SIMPLE_OS_PORT_H_
+
+#include <stdint.h>
+
+#include "simple_os_conf.h"
+
+#ifdef OS_PORT_HOST
+#include <time.h>
+#else
+#include "main.h"
+#endif /*  OS_PORT_HOST  */
+
+/* ------------------------------------------------------------------------- */
+
+/**
+ * @addtogroup  simple_os_port Simple OS port
+ * @{
+ * */
+
+/**
+ * @brief Cycle counter value. The counter is free running and wraps around,
+ * so only differences between 2 values are meaningful.
+ * */
+typedef uint32_t OS_Cycles_t;
+
+#ifdef OS_PORT_HOST
+
+/**
+ * @brief Cycle counter frequency (counts per second)
+ * */
+#define OS_PORT_CYCLES_PER_SEC          1000000000u
+
+/**
+ * @brief Initialize the cycle counter
+ * */
+#define OS_PORT_INIT_CYCLES()           do {} while(0)
+
+/**
+ * @brief Read the cycle counter
+ * */
+#define OS_PORT_GET_CYCLES()            OS_PORT_xGetHostCycles()
+
+/**
+ * @brief Enter a critical section, must be paired with OS_PORT_EXIT_CRITICAL() in the same scope
+ * */
+#define OS_PORT_ENTER_CRITICAL()        do {} while(0)
+
+/**
+ * @brief Exit a critical section entered by OS_PORT_ENTER_CRITICAL()
+ * */
+#define OS_PORT_EXIT_CRITICAL()         do {} while(0)
+
+/**
+ * @brief Atomically set bits of a 32-bit variable (interrupts may change the other bits)
+ * */
+#define OS_PORT_ATOMIC_SET(ptr, mask)   do { *(ptr) |= (mask); } while(0)
+
+/**
+ * @brief Atomically clear bits of a 32-bit variable (interrupts may change the other bits)
+ * */
+#define OS_PORT_ATOMIC_CLEAR(ptr, mask) do { *(ptr) &= ~(mask); } while(0)
+
+/**
+ * @brief Set a single bit of a 32-bit variable in SRAM, with a single store (no read-modify-write)
+ * */
+#define OS_PORT_BIT_SET(ptr, bit)       do { *(ptr) |= (1u << (bit)); } while(0)
+
+/**
+ * @brief Clear a single bit of a 32-bit variable in SRAM, with a single store (no read-modify-write)
+ * */
+#define OS_PORT_BIT_CLEAR(ptr, bit)     do { *(ptr) &= ~(1u << (bit)); } while(0)
+
+/**
+ * @brief Read a single bit of a 32-bit variable in SRAM, 0 or 1
+ * */
+#define OS_PORT_BIT_READ(ptr, bit)      ((*(ptr) >> (bit)) & 1u)
+
+/**
+ * @brief Count leading zeros of a 32-bit value, 32 if the value is 0
+ * */
+#define OS_PORT_CLZ(val)                (((val) == 0u) ? 32u : (uint32_t)__builtin_clz(val))
+
+static inline OS_Cycles_t OS_PORT_xGetHostCycles(void)
+{
+    struct timespec Local_sNow;
+
+    clock_gettime(CLOCK_MONOTONIC, &Local_sNow);
+
+    return (OS_Cycles_t)(((uint64_t)Local_sNow.tv_sec * 1000000000u) + (uint64_t)Local_sNow.tv_nsec);
+}
+
+#else
+
+#define OS_PORT_CYCLES_PER_SEC          SystemCoreClock
+
+#define OS_PORT_INIT_CYCLES()           do {                                                    \
+                                            CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;     \
+                                            DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;                \
+                                        } while(0)
+
+#define OS_PORT_GET_CYCLES()            ((OS_Cycles_t)DWT->CYCCNT)
+
+#if (OS_MAX_SYSCALL_PRIORITY >= (1u << __NVIC_PRIO_BITS))
+#error "OS_MAX_SYSCALL_PRIORITY must be lower than the number of NVIC priority levels"
+#endif
+
+#if OS_MAX_SYSCALL_PRIORITY
+
+/**
+ * @brief BASEPRI value masking interrupts of priority #OS_MAX_SYSCALL_PRIORITY and lower
+ * */
+#define OS_PORT_BASEPRI                 ((uint32_t)OS_MAX_SYSCALL_PRIORITY << (8u - __NVIC_PRIO_BITS))
+
+/*  BASEPRI_MAX only raises the masking level, critical sections nest  */
+#define OS_PORT_ENTER_CRITICAL()        uint32_t Local_u32PortBasepri = __get_BASEPRI(); \
+                                        __set_BASEPRI_MAX(OS_PORT_BASEPRI)
+
+#define OS_PORT_EXIT_CRITICAL()         __set_BASEPRI(Local_u32PortBasepri)
+
+#else
+
+#define OS_PORT_ENTER_CRITICAL()        uint32_t Local_u32PortPrimask = __get_PRIMASK(); \
+                                        __disable_irq()
+
+#define OS_PORT_EXIT_CRITICAL()         __set_PRIMASK(Local_u32PortPrimask)
+
+#endif /*  OS_MAX_SYSCALL_PRIORITY  */
+
+#define OS_PORT_ATOMIC_SET(ptr, mask)   OS_PORT_vidAtomicSet((ptr), (mask))
+
+#define OS_PORT_ATOMIC_CLEAR(ptr, mask) OS_PORT_vidAtomicClear((ptr), (mask))
+
+/**
+ * @brief Bit-band alias word of a bit of a variable in SRAM, each alias word maps a single bit
+ * */
+#define OS_PORT_BITBAND(ptr, bit)       (*(volatile uint32_t *)(SRAM_BB_BASE +                                  \
+                                            (((uint32_t)(uintptr_t)(ptr) - SRAM_BASE) << 5) + ((uint32_t)(bit) << 2)))
+
+#define OS_PORT_BIT_SET(ptr, bit)       do { OS_PORT_BITBAND((ptr), (bit)) = 1u; } while(0)
+
+#define OS_PORT_BIT_CLEAR(ptr, bit)     do { OS_PORT_BITBAND((ptr), (bit)) = 0u; } while(0)
+
+#define OS_PORT_BIT_READ(ptr, bit)      OS_PORT_BITBAND((ptr), (bit))
+
+#define OS_PORT_CLZ(val)                ((uint32_t)__CLZ(val))
+
+/*  a store fails if an interrupt (exception return clears the exclusive monitor)
+ *  ran between the load and the store, the read-modify-write is then retried  */
+static inline void OS_PORT_vidAtomicSet(volatile uint32_t * pu32Value, uint32_t u32Mask)
+{
+    uint32_t Local_u32Value;
+
+    do
+    {
+        Local_u32Value = __LDREXW(pu32Value);
+    } while(__STREXW(Local_u32Value | u32Mask, pu32Value));
+}
+
+static inline void OS_PORT_vidAtomicClear(volatile uint32_t * pu32Value, uint32_t u32Mask)
+{
+    uint32_t Local_u32Value;
+
+    do
+    {
+        Local_u32Value = __LDREXW(pu32Value);
+    } while(__STREXW(Local_u32Value & ~u32Mask, pu32Value));
+}
+
+#endif /*  OS_PORT_HOST  */
+
+/**@}*/
+
+#endif /* SIMPLE_OS_PORT_H_ */
@@ -0,0 +1,118 @@
+/*******************************************************************************
+ * @file    simple_os_prof.c
+ * @brief   Simple OS per-task execution profiling
+ * @details Profiling records and query API, see simple_os_prof.h
+ * @date    18 Oct. 2026
+ * @author  Mohammad Mohsen
+ ******************************************************************************/
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "utils/utils.h"
+
+#include "simple_os_prof.h"
+
+#if OS_USE_TASK_PROFILING
+
+/* ------------------------------------------------------------------------- */
+
+/**
+ * Profiling records, indexed by task priority
+ * */
+OS_TaskProf_t OS_asTaskProf [OS_TASK_COUNT];
+
+/**
+ * Cycle count at the start of the running task
+ * */
+OS_Cycles_t OS_xProfTaskStart;
+
+/* ------------------------------------------------------------------------- */
+
+static void OS_vidResetTaskProf(OS_TaskProf_t * psProf)
+{
+    OS_Cycles_t Local_xRelease = psProf->release;
+
+    memset(psProf, 0x00, sizeof(OS_TaskProf_t));
+
+    /*  keep pending release time, task may be waiting for execution  */
+    psProf->release  = Local_xRelease;
+    psProf->exec_min = UINT32_MAX;
+}
+
+/* ------------------------------------------------------------------------- */
+
+void OS_vidResetAllTaskStats(void)
+{
+    uint32_t Local_u32Priority;
+
+    for(Local_u32Priority = 0; Local_u32Priority < OS_TASK_COUNT; Local_u32Priority++)
+    {
+        OS_PORT_ENTER_CRITICAL();
+        OS_vidResetTaskProf(&OS_asTaskProf[Local_u32Priority]);
+        OS_PORT_EXIT_CRITICAL();
+    }
+}
+
+/* ------------------------------------------------------------------------- */
+
+OS_Error_t OS_enGetTaskStats(uint32_t u32Priority, OS_TaskStats_t * psStats)
+{
+    OS_TaskProf_t Local_sProf;
+
+    if(IS_NULLPTR(psStats))
+    {
+        return OS_ERROR_NULLPTR;
+    }
+
+    if(u32Priority >= OS_TASK_COUNT)
+    {
+        return OS_ERROR_INVALID_PARAM;
+    }
+
+    /*  overruns and release time are updated from OS_vidUpdateTasks()  */
+    OS_PORT_ENTER_CRITICAL();
+    Local_sProf = OS_asTaskProf[u32Priority];
+    OS_PORT_EXIT_CRITICAL();
+
+    psStats->runs           = Local_sProf.runs;
+    psStats->overruns       = Local_sProf.overruns;
+    psStats->exec_max       = Local_sProf.exec_max;
+    psStats->latency_max    = Local_sProf.latency_max;
+
+    if(IS_ZERO(Local_sProf.runs))
+    {
+        psStats->exec_min       = 0;
+        psStats->exec_mean      = 0;
+        psStats->latency_mean   = 0;
+    }
+    else
+    {
+        psStats->exec_min       = Local_sProf.exec_min;
+        psStats->exec_mean      = (uint32_t)(Local_sProf.exec_total / Local_sProf.runs);
+        psStats->latency_mean   = (uint32_t)(Local_sProf.latency_total / Local_sProf.runs);
+    }
+
+    return OS_ERROR_NONE;
+}
+
+/* ------------------------------------------------------------------------- */
+
+OS_Error_t OS_enResetTaskStats(uint32_t u32Priority)
+{
+    if(u32Priority >= OS_TASK_COUNT)
+    {
+        return OS_ERROR_INVALID_PARAM;
+    }
+
+    OS_PORT_ENTER_CRITICAL();
+    OS_vidResetTaskProf(&OS_asTaskProf[u32Priority]);
+    OS_PORT_EXIT_CRITICAL();
+
+    return OS_ERROR_NONE;
+}
+
+/* ------------------------------------------------------------------------- */
+
+#endif /*  OS_USE_TASK_PROFILING  */
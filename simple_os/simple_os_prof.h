@@ -0,0 +1,170 @@
+/*******************************************************************************
+ * @file    simple_os_prof.h
+ * @brief   Simple OS per-task execution profiling
+ * @details Optional instrumentation of the task dispatcher (#OS_USE_TASK_PROFILING).
+ *          For every task, Simple OS counts executions and overruns, and measures
+ *          execution time and release-to-start latency in cycles of the port's
+ *          cycle counter (see simple_os_port.h).
+ *
+ *          - Release: the tick at which OS_vidUpdateTasks() makes the task ready.
+ *          - Start / end: before / after the task's handler is called by OS_vidDispatchTasks().
+ *          - Overrun: the task is released while its previous job is still pending.
+ *
+ *          Execution time includes the time spent in interrupts that preempt the task.
+ * @date    18 Oct. 2026
+ * @author  Mohammad Mohsen
+ ******************************************************************************/
+
+#ifndef SIMPLE_OS_PROF_H_
+#define SIMPLE_OS_PROF_H_
+
+#include "simple_os.h"
+#include "simple_os_port.h"
+
+/* ------------------------------------------------------------------------- */
+
+/**
+ * @addtogroup  simple_os_prof Simple OS task profiling
+ * @{
+ * */
+
+/**
+ * @brief Task statistics, as returned by OS_enGetTaskStats()
+ * */
+typedef struct os_task_stats_t {
+    uint32_t    runs;               /**<  Number of times the task was executed  */
+    uint32_t    overruns;           /**<  Number of times the task was released while its previous job was pending  */
+    uint32_t    exec_min;           /**<  Minimum execution time (cycles)  */
+    uint32_t    exec_max;           /**<  Maximum execution time (cycles)  */
+    uint32_t    exec_mean;          /**<  Mean execution time (cycles)  */
+    uint32_t    latency_max;        /**<  Maximum release-to-start latency (cycles)  */
+    uint32_t    latency_mean;       /**<  Mean release-to-start latency (cycles)  */
+} OS_TaskStats_t;
+
+/**
+ * @brief Per-task profiling record (internal)
+ * */
+typedef struct os_task_prof_t {
+    OS_Cycles_t release;            /**<  Cycle count at the task's oldest pending release  */
+    uint32_t    runs;               /**<  Number of executions  */
+    uint32_t    overruns;           /**<  Number of overruns  */
+    uint32_t    exec_min;           /**<  Minimum execution time  */
+    uint32_t    exec_max;           /**<  Maximum execution time  */
+    uint32_t    latency_max;        /**<  Maximum release-to-start latency  */
+    uint64_t    exec_total;         /**<  Sum of execution times  */
+    uint64_t    latency_total;      /**<  Sum of release-to-start latencies  */
+} OS_TaskProf_t;
+
+/* ------------------------------------------------------------------------- */
+
+#if OS_USE_TASK_PROFILING
+
+/**
+ * Profiling records, indexed by task priority (internal)
+ * */
+extern OS_TaskProf_t OS_asTaskProf [OS_TASK_COUNT];
+
+/**
+ * Cycle count at the start of the running task (internal)
+ * */
+extern OS_Cycles_t OS_xProfTaskStart;
+
+/**
+ * @brief Reset all tasks' profiling records
+ *
+ * @param void
+ *
+ * @return void
+ * */
+void OS_vidResetAllTaskStats(void);
+
+/**
+ * @brief Get a task's statistics
+ *
+ * @param [in]  u32Priority : task's priority (task list index)
+ * @param [out] psStats     : pointer to a statistics structure to fill
+ *
+ * @return #OS_Error_t
+ *              OS_ERROR_NONE           : Statistics were copied to @p psStats
+ *              OS_ERROR_NULLPTR        : @p psStats is NULL
+ *              OS_ERROR_INVALID_PARAM  : @p u32Priority is out of range
+ * */
+OS_Error_t OS_enGetTaskStats(uint32_t u32Priority, OS_TaskStats_t * psStats);
+
+/**
+ * @brief Reset a task's statistics
+ *
+ * @param [in] u32Priority : task's priority (task list index)
+ *
+ * @return #OS_Error_t
+ *              OS_ERROR_NONE           : Statistics were reset
+ *              OS_ERROR_INVALID_PARAM  : @p u32Priority is out of range
+ * */
+OS_Error_t OS_enResetTaskStats(uint32_t u32Priority);
+
+/* ------------------------------------------------------------------------- */
+
+/**
+ * @brief Record a task's release, called by OS_vidUpdateTasks() (internal)
+ * */
+static inline void OS_vidProfTaskRelease(uint32_t u32Priority)
+{
+    OS_asTaskProf[u32Priority].release = OS_PORT_GET_CYCLES();
+}
+
+/**
+ * @brief Record a task's overrun, called by OS_vidUpdateTasks() (internal)
+ * */
+static inline void OS_vidProfTaskOverrun(uint32_t u32Priority)
+{
+    OS_asTaskProf[u32Priority].overruns++;
+}
+
+/**
+ * @brief Record the start of a task's execution, called by OS_vidDispatchTasks() (internal)
+ * */
+static inline void OS_vidProfTaskStart(uint32_t u32Priority)
+{
+    OS_TaskProf_t * Local_psProf = &OS_asTaskProf[u32Priority];
+    uint32_t Local_u32Latency;
+
+    OS_xProfTaskStart = OS_PORT_GET_CYCLES();
+
+    Local_u32Latency = OS_xProfTaskStart - Local_psProf->release;
+
+    Local_psProf->latency_total += Local_u32Latency;
+    if(Local_u32Latency > Local_psProf->latency_max)
+    {
+        Local_psProf->latency_max = Local_u32Latency;
+    }
+}
+
+/**
+ * @brief Record the end of a task's execution, called by OS_vidDispatchTasks() (internal)
+ * */
+static inline void OS_vidProfTaskEnd(uint32_t u32Priority)
+{
+    OS_TaskProf_t * Local_psProf = &OS_asTaskProf[u32Priority];
+    uint32_t Local_u32Exec;
+
+    Local_u32Exec = OS_PORT_GET_CYCLES() - OS_xProfTaskStart;
+
+    Local_psProf->runs++;
+    Local_psProf->exec_total += Local_u32Exec;
+
+    if(Local_u32Exec < Local_psProf->exec_min)
+    {
+        Local_psProf->exec_min = Local_u32Exec;
+    }
+
+    if(Local_u32Exec > Local_psProf->exec_max)
+    {
+        Local_psProf->exec_max = Local_u32Exec;
+    }
+}
+
+#endif /*  OS_USE_TASK_PROFILING  */
+
+/**@}*/
+
+#endif /* SIMPLE_OS_PROF_H_ */
@@ -0,0 +1,46 @@
+/*******************************************************************************
+ * @file    simple_os_pt.c
+ * @brief   Simple OS protothreads
+ * @details Scheduler integration of the blocking statements, see simple_os_pt.h
+ * @date    18 Oct. 2026
+ * @author  Mohammad Mohsen
+ ******************************************************************************/
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "utils/utils.h"
+
+#include "simple_os_pt.h"
+
+/* ------------------------------------------------------------------------- */
+
+void OS_vidPtInit(OS_Pt_t * psPt, OS_TaskHandle_t xTask)
+{
+    psPt->u32Resume = 0;
+    psPt->xTask     = xTask;
+}
+
+/* ------------------------------------------------------------------------- */
+
+void OS_vidPtYield(const OS_Pt_t * psPt)
+{
+    /*  a job released while the task executes is kept, and served by the next dispatch pass  */
+    (void)OS_enReadyTask(psPt->xTask);
+}
+
+/* ------------------------------------------------------------------------- */
+
+void OS_vidPtSleep(const OS_Pt_t * psPt, OS_Tick_t xTicks)
+{
+    if(IS_ZERO(xTicks))
+    {
+        OS_vidPtYield(psPt);
+        return;
+    }
+
+    /*  fails for event tasks, the wait then ends at the task's next release  */
+    (void)OS_enSetTaskDelay(psPt->xTask, xTicks);
+}
+
+/* ------------------------------------------------------------------------- */
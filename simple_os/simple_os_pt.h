@@ -0,0 +1,167 @@
+/*******************************************************************************
+ * @file    simple_os_pt.h
+ * @brief   Simple OS protothreads
+ * @details Stackless coroutines for long running operations (multi-step I/O,
+ *          parsing, ...) written as sequential code instead of hand written state
+ *          machines. A protothread is the handler of a periodic or event task: it
+ *          returns to the dispatcher at each blocking statement, and resumes there
+ *          at the task's next execution. It needs no stack of its own, only its
+ *          resume point (#OS_Pt_t, 8 bytes).
+ *
+ *          @code
+ *          static OS_Pt_t parser_pt;
+ *          static UART_RxFrame_t frame;
+ *
+ *          static void parser_task(void * const pvArgs)
+ *          {
+ *              OS_Pt_t * pt = pvArgs;
+ *
+ *              OS_PT_BEGIN(pt);
+ *
+ *              for(;;)
+ *              {
+ *                  OS_PT_WAIT_UNTIL(pt, UART_u32RxGetFrame(&frame));
+ *                  parse_frame(&frame);
+ *                  UART_u32RxReleaseFrame();
+ *
+ *                  OS_PT_WAIT_TICKS(pt, OS_MS_TO_TICKS(5));
+ *                  send_ack();
+ *              }
+ *
+ *              OS_PT_END(pt);
+ *          }
+ *
+ *          OS_enAddTask(parser_task, &parser_pt, 2, OS_MS_TO_TICKS(20), 0, &handle);
+ *          OS_vidPtInit(&parser_pt, handle);
+ *          @endcode
+ *
+ *          Integration with the scheduler, the protothread resumes when its task is released:
+ *          - OS_PT_YIELD()      : releases the task again (OS_enReadyTask()), it resumes
+ *                                 at the next OS_vidDispatchTasks() pass, after the other ready tasks
+ *          - OS_PT_WAIT_UNTIL() : the condition is checked at each release of the task, i.e.
+ *                                 each period, or when a producer calls OS_enReadyTask()
+ *                                 (queue.h, event.h, bus.h wake up the task this way)
+ *          - OS_PT_WAIT_TICKS() : delays the task's next release (OS_enSetTaskDelay()), periodic
+ *                                 tasks only, the period restarts when the wait ends. A release
+ *                                 before the ticks elapse (e.g. OS_enReadyTask()) ends the wait early
+ *
+ *          Implemented with switch / case resume points (Duff's device, standard C99):
+ *          - local variables are not kept across blocking statements, keep state in
+ *            static variables or in a structure passed as the task's argument
+ *          - blocking statements can't be used inside a switch statement of the protothread,
+ *            nor twice on the same source line
+ *          - blocking statements can only be used in the task's handler itself, not in
+ *            functions it calls
+ * @date    18 Oct. 2026
+ * @author  Mohammad Mohsen
+ ******************************************************************************/
+
+#ifndef SIMPLE_OS_PT_H_
+#define SIMPLE_OS_PT_H_
+
+#include <stdint.h>
+
+#include "simple_os.h"
+
+/* ------------------------------------------------------------------------- */
+
+/**
+ * @addtogroup  simple_os_pt Simple OS protothreads
+ * @{
+ * */
+
+/**
+ * @brief Protothread state
+ * */
+typedef struct os_pt_t {
+    uint32_t            u32Resume;  /**<  Resume point (source line of the last blocking statement), 0 at the start  */
+    OS_TaskHandle_t     xTask;      /**<  Task running the protothread  */
+} OS_Pt_t;
+
+/* ------------------------------------------------------------------------- */
+
+/**
+ * @brief Start of the protothread's body, first statement of the task's handler
+ *
+ * @param [in] psPt : protothread (#OS_Pt_t *)
+ * */
+#define OS_PT_BEGIN(psPt)                   switch((psPt)->u32Resume) { case 0u:
+
+/**
+ * @brief End of the protothread's body, last statement of the task's handler.
+ * The protothread restarts from OS_PT_BEGIN() at the task's next release.
+ *
+ * @param [in] psPt : protothread (#OS_Pt_t *)
+ * */
+#define OS_PT_END(psPt)                     default: break; } (psPt)->u32Resume = 0u
+
+/**
+ * @brief Let the other ready tasks execute, resume at the next dispatch pass
+ *
+ * @param [in] psPt : protothread (#OS_Pt_t *)
+ * */
+#define OS_PT_YIELD(psPt)                   do {                                                \
+                                                OS_vidPtYield(psPt);                            \
+                                                (psPt)->u32Resume = __LINE__; return;           \
+                                                case __LINE__: ;                                \
+                                            } while(0)
+
+/**
+ * @brief Wait until a condition is true, checked now and at each release of the task
+ *
+ * @param [in] psPt       : protothread (#OS_Pt_t *)
+ * @param [in] xCondition : condition
+ * */
+/*  resume point is inside if(0), no statement falls through to the case label (-Wimplicit-fallthrough)  */
+#define OS_PT_WAIT_UNTIL(psPt, xCondition)  do {                                                \
+                                                (psPt)->u32Resume = __LINE__;                   \
+                                                if(0) { case __LINE__: ; }                      \
+                                                if(!(xCondition)) { return; }                   \
+                                            } while(0)
+
+/**
+ * @brief Wait for a number of ticks (periodic tasks only), resume at the task's delayed release
+ *
+ * @param [in] psPt   : protothread (#OS_Pt_t *)
+ * @param [in] xTicks : ticks to wait, 0 to yield
+ * */
+#define OS_PT_WAIT_TICKS(psPt, xTicks)      do {                                                \
+                                                OS_vidPtSleep((psPt), (xTicks));                \
+                                                (psPt)->u32Resume = __LINE__; return;           \
+                                                case __LINE__: ;                                \
+                                            } while(0)
+
+/**
+ * @brief Leave the protothread, it restarts from OS_PT_BEGIN() at the task's next release
+ *
+ * @param [in] psPt : protothread (#OS_Pt_t *)
+ * */
+#define OS_PT_EXIT(psPt)                    do {                                                \
+                                                (psPt)->u32Resume = 0u; return;                 \
+                                            } while(0)
+
+/* ------------------------------------------------------------------------- */
+
+/**
+ * @brief Initialize (or restart) a protothread, before its task is first executed
+ *
+ * @param [out] psPt  : protothread
+ * @param [in]  xTask : task running the protothread (got from OS_enAddTask() or OS_enAddEventTask())
+ *
+ * @return void
+ * */
+void OS_vidPtInit(OS_Pt_t * psPt, OS_TaskHandle_t xTask);
+
+/**
+ * @brief Release the protothread's task again, called by OS_PT_YIELD() (internal)
+ * */
+void OS_vidPtYield(const OS_Pt_t * psPt);
+
+/**
+ * @brief Delay the protothread's task next release, called by OS_PT_WAIT_TICKS() (internal)
+ * */
+void OS_vidPtSleep(const OS_Pt_t * psPt, OS_Tick_t xTicks);
+
+/**@}*/
+
+#endif /* SIMPLE_OS_PT_H_ */
@@ -0,0 +1,253 @@
+/*******************************************************************************
+ * @file    simple_os_thread.c
+ * @brief   Simple OS stackful cooperative threads
+ * @details Threads' tasks & PendSV context switch, see simple_os_thread.h
+ *
+ *          The thread's task handler sets #OS_psThreadCurrent and pends PendSV, which
+ *          saves the dispatcher's R4-R11 on the main stack, and restores the thread's
+ *          context from its stack. Yielding pends PendSV again, which saves the thread's
+ *          R4-R11 on its stack, and returns to the task handler, as if PendSV never ran.
+ *          PendSV has the lowest priority, so a switch never preempts an interrupt handler.
+ * @date    18 Oct. 2026
+ * @author  Mohammad Mohsen
+ ******************************************************************************/
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "utils/utils.h"
+
+#include "simple_os_thread.h"
+
+#if OS_USE_THREADS
+
+#ifdef OS_PORT_HOST
+#error "OS_USE_THREADS is only supported by the Cortex-M3 port"
+#endif /*  OS_PORT_HOST  */
+
+/* ------------------------------------------------------------------------- */
+
+/**
+ * Initial xPSR, Thumb state
+ * */
+#define OS_THREAD_INITIAL_XPSR          0x01000000u
+
+/**
+ * Words of a thread's initial context: R4-R11 then the exception frame (R0-R3, R12, LR, PC, xPSR)
+ * */
+#define OS_THREAD_CONTEXT_WORDS         16u
+
+/* ------------------------------------------------------------------------- */
+
+OS_Thread_t * volatile OS_psThreadCurrent = NULL;
+
+/* ------------------------------------------------------------------------- */
+
+/**
+ * @brief Switch between the dispatcher and the current thread, both ways
+ * */
+static inline void OS_vidThreadSwitch(void)
+{
+    SCB->ICSR = SCB_ICSR_PENDSVSET_Msk;
+    __DSB();
+    __ISB();
+}
+
+/* ------------------------------------------------------------------------- */
+
+/**
+ * @brief First function executed on a thread's stack, runs the thread's entry function
+ *
+ * @param [in] psThread : thread
+ * */
+static void OS_vidThreadStart(OS_Thread_t * psThread)
+{
+    psThread->pfEntry(psThread->pvArgs);
+
+    /*  not deleted, the dispatcher is still executing the task  */
+    psThread->enState = OS_THREAD_STATE_FINISHED;
+    (void)OS_enSuspendTask(psThread->xTask);
+
+    for(;;)
+    {
+        OS_vidThreadSwitch();
+    }
+}
+
+/* ------------------------------------------------------------------------- */
+
+/**
+ * @brief Thread's task handler, runs the thread until it yields
+ *
+ * @param [in] pvArgs : thread
+ * */
+static void OS_vidThreadRun(void * const pvArgs)
+{
+    OS_Thread_t * Local_psThread = pvArgs;
+
+    if(Local_psThread->enState == OS_THREAD_STATE_FINISHED)
+    {
+        return;
+    }
+
+    Local_psThread->enState = OS_THREAD_STATE_RUNNING;
+    OS_psThreadCurrent = Local_psThread;
+
+    OS_vidThreadSwitch();
+
+    OS_psThreadCurrent = NULL;
+
+    if(Local_psThread->enState == OS_THREAD_STATE_RUNNING)
+    {
+        Local_psThread->enState = OS_THREAD_STATE_READY;
+    }
+}
+
+/* ------------------------------------------------------------------------- */
+
+OS_Error_t OS_enAddThread(OS_Thread_t * psThread, OS_vidTaskHandler_t pfEntry, void * const pvArgs,
+                          uint32_t u32Priority, OS_Tick_t u32Period, OS_TaskHandle_t * pTaskHandle)
+{
+    OS_Error_t Local_enError;
+    uint32_t * Local_pu32Sp;
+    uint32_t Local_u32Idx;
+
+    if(IS_NULLPTR(psThread) || IS_NULLPTR(pfEntry) || IS_NULLPTR(pTaskHandle))
+    {
+        return OS_ERROR_NULLPTR;
+    }
+
+    if(psThread->enState == OS_THREAD_STATE_RUNNING)
+    {
+        return OS_ERROR_INVALID_PARAM;
+    }
+
+    if(IS_ZERO(u32Period))
+    {
+        Local_enError = OS_enAddEventTask(OS_vidThreadRun, psThread, u32Priority, pTaskHandle);
+    }
+    else
+    {
+        Local_enError = OS_enAddTask(OS_vidThreadRun, psThread, u32Priority, u32Period, 0, pTaskHandle);
+    }
+
+    if(Local_enError != OS_ERROR_NONE)
+    {
+        return Local_enError;
+    }
+
+    for(Local_u32Idx = 0; Local_u32Idx < (psThread->u32StackSize / sizeof(uint32_t)); Local_u32Idx++)
+    {
+        psThread->pu32Stack[Local_u32Idx] = OS_THREAD_STACK_FILL;
+    }
+
+    /*  context as saved by PendSV_Handler(), returns to OS_vidThreadStart(psThread)  */
+    Local_pu32Sp = psThread->pu32Stack + (psThread->u32StackSize / sizeof(uint32_t)) - OS_THREAD_CONTEXT_WORDS;
+
+    for(Local_u32Idx = 0; Local_u32Idx < OS_THREAD_CONTEXT_WORDS; Local_u32Idx++)
+    {
+        Local_pu32Sp[Local_u32Idx] = 0;
+    }
+
+    Local_pu32Sp[8]  = (uint32_t)psThread;                                      /*  R0    */
+    Local_pu32Sp[14] = (uint32_t)OS_vidThreadStart & ~0x01u;                    /*  PC    */
+    Local_pu32Sp[15] = OS_THREAD_INITIAL_XPSR;                                  /*  xPSR  */
+
+    psThread->u32Sp     = (uint32_t)Local_pu32Sp;
+    psThread->pfEntry   = pfEntry;
+    psThread->pvArgs    = pvArgs;
+    psThread->xTask     = *pTaskHandle;
+    psThread->enState   = OS_THREAD_STATE_READY;
+
+    NVIC_SetPriority(PendSV_IRQn, (1u << __NVIC_PRIO_BITS) - 1u);
+
+    if(IS_ZERO(u32Period))
+    {
+        (void)OS_enReadyTask(psThread->xTask);
+    }
+
+    return OS_ERROR_NONE;
+}
+
+/* ------------------------------------------------------------------------- */
+
+void OS_vidThreadYield(void)
+{
+    OS_Thread_t * Local_psThread = OS_psThreadCurrent;
+
+    if(IS_NULLPTR(Local_psThread))
+    {
+        return;
+    }
+
+    /*  a job released while the task executes is kept, and served by the next dispatch pass  */
+    (void)OS_enReadyTask(Local_psThread->xTask);
+
+    OS_vidThreadSwitch();
+}
+
+/* ------------------------------------------------------------------------- */
+
+void OS_vidThreadWait(void)
+{
+    if(IS_NULLPTR(OS_psThreadCurrent))
+    {
+        return;
+    }
+
+    OS_vidThreadSwitch();
+}
+
+/* ------------------------------------------------------------------------- */
+
+uint32_t OS_u32ThreadStackUnused(const OS_Thread_t * psThread)
+{
+    uint32_t Local_u32Idx = 0;
+
+    while((Local_u32Idx < (psThread->u32StackSize / sizeof(uint32_t))) &&
+          (psThread->pu32Stack[Local_u32Idx] == OS_THREAD_STACK_FILL))
+    {
+        Local_u32Idx++;
+    }
+
+    return Local_u32Idx * sizeof(uint32_t);
+}
+
+/* ------------------------------------------------------------------------- */
+
+/**
+ * @brief Context switch, pended by OS_vidThreadSwitch()
+ *
+ * - From the dispatcher (EXC_RETURN uses MSP) : save R4-R11 on the main stack, restore
+ *   the current thread's R4-R11 and return to the thread, using its stack (PSP)
+ * - From a thread (EXC_RETURN uses PSP)       : save R4-R11 on the thread's stack, restore
+ *   the dispatcher's R4-R11 and return to the dispatcher, using the main stack (MSP)
+ * */
+__attribute__((naked)) void PendSV_Handler(void)
+{
+    __asm volatile(
+        "   ldr     r1, =OS_psThreadCurrent             \n"
+        "   ldr     r1, [r1]                            \n"     /*  r1 = current thread  */
+        "   tst     lr, #4                              \n"
+        "   bne     1f                                  \n"
+        /*  dispatcher -> thread  */
+        "   push    {r4-r11}                            \n"
+        "   ldr     r0, [r1]                            \n"     /*  thread's saved SP  */
+        "   ldmia   r0!, {r4-r11}                       \n"
+        "   msr     psp, r0                             \n"
+        "   mvn     lr, #2                              \n"     /*  0xFFFFFFFD: thread mode, PSP  */
+        "   bx      lr                                  \n"
+        /*  thread -> dispatcher  */
+        "1: mrs     r0, psp                             \n"
+        "   stmdb   r0!, {r4-r11}                       \n"
+        "   str     r0, [r1]                            \n"
+        "   pop     {r4-r11}                            \n"
+        "   mvn     lr, #6                              \n"     /*  0xFFFFFFF9: thread mode, MSP  */
+        "   bx      lr                                  \n"
+        "   .ltorg                                      \n"
+    );
+}
+
+/* ------------------------------------------------------------------------- */
+
+#endif /*  OS_USE_THREADS  */
@@ -0,0 +1,169 @@
+/*******************************************************************************
+ * @file    simple_os_thread.h
+ * @brief   Simple OS stackful cooperative threads
+ * @details Optional (#OS_USE_THREADS) threads for code that blocks in loops and
+ *          can't be rewritten as a state machine or a protothread (simple_os_pt.h).
+ *          A thread has its own stack, and runs on behalf of a periodic or event task:
+ *          when the task is executed, the dispatcher switches to the thread's stack,
+ *          and the thread runs until it yields, then the dispatcher goes on with
+ *          the other tasks. Threads are cooperative, they're never preempted by the
+ *          dispatcher (interrupts still preempt them).
+ *
+ *          @code
+ *          OS_THREAD_DEFINE(legacy_thread, 512);                   // 512 bytes stack
+ *
+ *          static void legacy_main(void * const pvArgs)
+ *          {
+ *              for(;;)
+ *              {
+ *                  while(!LL_USART_IsActiveFlag_RXNE(USART2))
+ *                  {
+ *                      OS_vidThreadYield();                        // instead of busy waiting
+ *                  }
+ *                  ...
+ *                  OS_vidThreadWait();                             // until the next period
+ *              }
+ *          }
+ *
+ *          OS_enAddThread(&legacy_thread, legacy_main, NULL, 3, OS_MS_TO_TICKS(10), &handle);
+ *          @endcode
+ *
+ *          - OS_vidThreadYield() : resume at the next OS_vidDispatchTasks() pass, after the other ready tasks
+ *          - OS_vidThreadWait()  : resume at the task's next release, each period, or when
+ *                                  released by OS_enReadyTask() (queue.h, event.h, bus.h)
+ *
+ *          Context switches are done by PendSV_Handler(), the dispatcher runs on the
+ *          main stack (MSP), threads on the process stack (PSP). A switch saves R4-R11
+ *          on the stack being left, the exception entry saves the other registers.
+ *          A thread's stack must hold its own usage, its saved context (64 bytes), and an
+ *          interrupt's exception frame (36 bytes), interrupt handlers run on the main stack.
+ *          Stacks are filled with #OS_THREAD_STACK_FILL, OS_u32ThreadStackUnused() reports
+ *          the stack never used so far.
+ *
+ *          Cortex-M3 port only.
+ * @date    18 Oct. 2026
+ * @author  Mohammad Mohsen
+ ******************************************************************************/
+
+#ifndef SIMPLE_OS_THREAD_H_
+#define SIMPLE_OS_THREAD_H_
+
+#include <stdint.h>
+
+#include "simple_os.h"
+#include "simple_os_port.h"
+
+/* ------------------------------------------------------------------------- */
+
+/**
+ * @addtogroup  simple_os_thread Simple OS threads
+ * @{
+ * */
+
+/**
+ * @brief Minimum thread stack size in bytes: saved context, an exception frame, and a few calls
+ * */
+#define OS_THREAD_STACK_MIN             256u
+
+/**
+ * @brief Value unused stack words are filled with
+ * */
+#define OS_THREAD_STACK_FILL            0xA5A5A5A5u
+
+/**
+ * @brief Thread states
+ * */
+typedef enum os_thread_state_t {
+    OS_THREAD_STATE_READY       = 0,    /**<  Started or waiting for its task's next execution  */
+    OS_THREAD_STATE_RUNNING,            /**<  Running, on behalf of its task  */
+    OS_THREAD_STATE_FINISHED,           /**<  Entry function returned, its task is suspended  */
+} OS_ThreadState_t;
+
+/**
+ * @brief Thread, defined by OS_THREAD_DEFINE()
+ * */
+typedef struct os_thread_t {
+    uint32_t                u32Sp;          /**<  Saved stack pointer, first member (PendSV_Handler())  */
+    uint32_t *              pu32Stack;      /**<  Stack, lowest address  */
+    uint32_t                u32StackSize;   /**<  Stack size in bytes  */
+    OS_vidTaskHandler_t     pfEntry;        /**<  Entry function  */
+    void *                  pvArgs;         /**<  Argument passed to the entry function  */
+    OS_TaskHandle_t         xTask;          /**<  Task running the thread  */
+    OS_ThreadState_t        enState;        /**<  Thread state  */
+} OS_Thread_t;
+
+/**
+ * @brief Define a thread and its stack
+ *
+ * @param [in] xName         : thread name
+ * @param [in] u32StackBytes : stack size in bytes, at least #OS_THREAD_STACK_MIN, rounded up to 8 bytes
+ * */
+#define OS_THREAD_DEFINE(xName, u32StackBytes) \
+    typedef char xName##_stack_must_be_at_least_OS_THREAD_STACK_MIN [((u32StackBytes) >= OS_THREAD_STACK_MIN) ? 1 : -1]; \
+    static uint64_t xName##_stack [((u32StackBytes) + 7u) / 8u]; \
+    OS_Thread_t xName = { \
+        .pu32Stack      = (uint32_t *)xName##_stack, \
+        .u32StackSize   = sizeof(xName##_stack), \
+    }
+
+/* ------------------------------------------------------------------------- */
+
+#if OS_USE_THREADS
+
+/**
+ * Thread being run by the dispatcher, NULL if none (internal, PendSV_Handler())
+ * */
+extern OS_Thread_t * volatile OS_psThreadCurrent;
+
+/**
+ * @brief Add a task running a thread. The thread is started at the task's first execution.
+ *
+ * @param [in]  psThread    : thread, defined by OS_THREAD_DEFINE()
+ * @param [in]  pfEntry     : thread's entry function, the thread finishes when it returns
+ * @param [in]  pvArgs      : argument passed to @p pfEntry
+ * @param [in]  u32Priority : task priority
+ * @param [in]  u32Period   : task period in ticks, 0 for an event task (started at the next dispatch pass)
+ * @param [out] pTaskHandle : task handle
+ *
+ * @return #OS_Error_t
+ *              OS_ERROR_NONE           : Thread was added
+ *              OS_ERROR_NULLPTR        : @p psThread, @p pfEntry or @p pTaskHandle is NULL
+ *              OS_ERROR_INVALID_PARAM  : @p u32Priority is out of range, or the thread is running
+ * */
+OS_Error_t OS_enAddThread(OS_Thread_t * psThread, OS_vidTaskHandler_t pfEntry, void * const pvArgs,
+                          uint32_t u32Priority, OS_Tick_t u32Period, OS_TaskHandle_t * pTaskHandle);
+
+/**
+ * @brief Switch back to the dispatcher, resume at the next dispatch pass.
+ * Does nothing if not called by a thread.
+ *
+ * @param void
+ *
+ * @return void
+ * */
+void OS_vidThreadYield(void);
+
+/**
+ * @brief Switch back to the dispatcher, resume at the task's next release.
+ * Does nothing if not called by a thread.
+ *
+ * @param void
+ *
+ * @return void
+ * */
+void OS_vidThreadWait(void);
+
+/**
+ * @brief Get a thread's stack never used so far (stack high water mark)
+ *
+ * @param [in] psThread : thread
+ *
+ * @return Unused stack in bytes
+ * */
+uint32_t OS_u32ThreadStackUnused(const OS_Thread_t * psThread);
+
+#endif /*  OS_USE_THREADS  */
+
+/**@}*/
+
+#endif /* SIMPLE_OS_THREAD_H_ */
@@ -0,0 +1,163 @@
+/*******************************************************************************
+ * @file    simple_os_trace.c
+ * @brief   Simple OS scheduling event trace recorder
+ * @details Record encoding and ring buffer, see simple_os_trace.h
+ * @date    18 Oct. 2026
+ * @author  Mohammad Mohsen
+ ******************************************************************************/
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "utils/utils.h"
+
+#include "simple_os_trace.h"
+
+#if OS_USE_TRACE
+
+/* ------------------------------------------------------------------------- */
+
+/**
+ * Trace recorder state
+ * */
+volatile OS_TraceState_t OS_sTraceState;
+
+/* ------------------------------------------------------------------------- */
+
+/**
+ * @brief Encode an unsigned LEB128 value
+ *
+ * @return Number of bytes written to @p pu8Out
+ * */
+static uint32_t OS_u32TraceEncode(uint8_t * pu8Out, uint32_t u32Value)
+{
+    uint32_t Local_u32Len = 0;
+
+    while(u32Value >= 0x80u)
+    {
+        pu8Out[Local_u32Len++] = (uint8_t)(u32Value | 0x80u);
+        u32Value >>= 7;
+    }
+
+    pu8Out[Local_u32Len++] = (uint8_t)u32Value;
+
+    return Local_u32Len;
+}
+
+/**
+ * @brief Copy a record to the ring buffer, if there is room for it
+ *
+ * @return 1 if the record was written, 0 if the buffer is full
+ * */
+static uint32_t OS_u32TraceWrite(const uint8_t * pu8Record, uint32_t u32Len)
+{
+    uint32_t Local_u32Head = OS_sTraceState.head;
+    uint32_t Local_u32Idx;
+
+    if((OS_TRACE_BUFFER_SIZE - (Local_u32Head - OS_sTraceState.tail)) < u32Len)
+    {
+        return 0;
+    }
+
+    for(Local_u32Idx = 0; Local_u32Idx < u32Len; Local_u32Idx++)
+    {
+        OS_sTraceState.buffer[(Local_u32Head + Local_u32Idx) & (OS_TRACE_BUFFER_SIZE - 1)] = pu8Record[Local_u32Idx];
+    }
+
+    /*  publish the record after its bytes  */
+    OS_sTraceState.head = Local_u32Head + u32Len;
+
+    return 1;
+}
+
+/* ------------------------------------------------------------------------- */
+
+void OS_vidTraceReset(void)
+{
+    OS_PORT_ENTER_CRITICAL();
+    OS_sTraceState.head = 0;
+    OS_sTraceState.tail = 0;
+    OS_sTraceState.lost = 0;
+    OS_sTraceState.last = OS_PORT_GET_CYCLES();
+    OS_PORT_EXIT_CRITICAL();
+}
+
+/* ------------------------------------------------------------------------- */
+
+void OS_vidTraceRecord(OS_TraceEvent_t enEvent, uint32_t u32Id)
+{
+    uint8_t Local_au8Record [OS_TRACE_RECORD_MAX];
+    uint32_t Local_u32Len;
+    OS_Cycles_t Local_xNow;
+
+    /*  called from both thread and interrupt context, a record is written atomically  */
+    OS_PORT_ENTER_CRITICAL();
+
+    Local_xNow = OS_PORT_GET_CYCLES();
+
+    if(OS_sTraceState.lost)
+    {
+        Local_au8Record[0] = (uint8_t)(OS_TRACE_EVENT_LOST << OS_TRACE_EVENT_SHIFT);
+        Local_u32Len = 1;
+        Local_u32Len += OS_u32TraceEncode(&Local_au8Record[Local_u32Len], Local_xNow - OS_sTraceState.last);
+        Local_u32Len += OS_u32TraceEncode(&Local_au8Record[Local_u32Len], OS_sTraceState.lost);
+
+        if(OS_u32TraceWrite(Local_au8Record, Local_u32Len))
+        {
+            OS_sTraceState.last = Local_xNow;
+            OS_sTraceState.lost = 0;
+        }
+    }
+
+    Local_au8Record[0] = (uint8_t)((enEvent << OS_TRACE_EVENT_SHIFT) | (u32Id & OS_TRACE_ID_MASK));
+    Local_u32Len = 1;
+    Local_u32Len += OS_u32TraceEncode(&Local_au8Record[Local_u32Len], Local_xNow - OS_sTraceState.last);
+
+    if(!IS_ZERO(OS_sTraceState.lost) || !OS_u32TraceWrite(Local_au8Record, Local_u32Len))
+    {
+        OS_sTraceState.lost++;
+    }
+    else
+    {
+        OS_sTraceState.last = Local_xNow;
+    }
+
+    OS_PORT_EXIT_CRITICAL();
+}
+
+/* ------------------------------------------------------------------------- */
+
+uint32_t OS_u32TraceRead(uint8_t * pu8Buffer, uint32_t u32Size)
+{
+    uint32_t Local_u32Tail;
+    uint32_t Local_u32Count;
+    uint32_t Local_u32Idx;
+
+    if(IS_NULLPTR(pu8Buffer))
+    {
+        return 0;
+    }
+
+    /*  records are only appended by writers, the tail is only moved here  */
+    Local_u32Tail   = OS_sTraceState.tail;
+    Local_u32Count  = OS_sTraceState.head - Local_u32Tail;
+
+    if(Local_u32Count > u32Size)
+    {
+        Local_u32Count = u32Size;
+    }
+
+    for(Local_u32Idx = 0; Local_u32Idx < Local_u32Count; Local_u32Idx++)
+    {
+        pu8Buffer[Local_u32Idx] = OS_sTraceState.buffer[(Local_u32Tail + Local_u32Idx) & (OS_TRACE_BUFFER_SIZE - 1)];
+    }
+
+    OS_sTraceState.tail = Local_u32Tail + Local_u32Count;
+
+    return Local_u32Count;
+}
+
+/* ------------------------------------------------------------------------- */
+
+#endif /*  OS_USE_TRACE  */
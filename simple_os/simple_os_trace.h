@@ -0,0 +1,158 @@
+/*******************************************************************************
+ * @file    simple_os_trace.h
+ * @brief   Simple OS scheduling event trace recorder
+ * @details Optional trace recorder (#OS_USE_TRACE) that records scheduling events
+ *          into a RAM ring buffer of #OS_TRACE_BUFFER_SIZE bytes:
+ *          - task release, overrun, start and end (from the scheduler)
+ *          - tick interrupt entry / exit (OS_vidUpdateTasks() entry / exit)
+ *          - other interrupts entry / exit, using OS_vidTraceIsrEnter() / OS_vidTraceIsrExit()
+ *
+ *          Record format (2 to 11 bytes):
+ *          - header byte: event (bits [7:5]) | task priority or ISR id (bits [4:0])
+ *          - timestamp: cycles since the previous record, unsigned LEB128 (1 to 5 bytes)
+ *          - #OS_TRACE_EVENT_LOST only: number of lost records, unsigned LEB128 (1 to 5 bytes)
+ *
+ *          When the buffer is full, new records are dropped and counted, a
+ *          #OS_TRACE_EVENT_LOST record is written once there is room again.
+ *          Records are consumed using OS_u32TraceRead(), the byte stream is
+ *          converted to Perfetto / Chrome trace JSON by Tools/trace2perfetto.py.
+ *
+ *          Timestamp deltas are 32-bit, so 2 consecutive records must be less than
+ *          2^32 cycles apart (~9 minutes at 8 MHz).
+ * @date    18 Oct. 2026
+ * @author  Mohammad Mohsen
+ ******************************************************************************/
+
+#ifndef SIMPLE_OS_TRACE_H_
+#define SIMPLE_OS_TRACE_H_
+
+#include "simple_os.h"
+#include "simple_os_port.h"
+
+/* ------------------------------------------------------------------------- */
+
+/**
+ * @addtogroup  simple_os_trace Simple OS trace recorder
+ * @{
+ * */
+
+/**
+ * @brief Trace event types, stored in the 3 upper bits of a record's header
+ * */
+typedef enum os_trace_event_t {
+    OS_TRACE_EVENT_RELEASE      = 0,    /**<  Task released (first pending job)  */
+    OS_TRACE_EVENT_OVERRUN      = 1,    /**<  Task released while its previous job is pending  */
+    OS_TRACE_EVENT_START        = 2,    /**<  Task handler called  */
+    OS_TRACE_EVENT_END          = 3,    /**<  Task handler returned  */
+    OS_TRACE_EVENT_ISR_ENTER    = 4,    /**<  Interrupt entry  */
+    OS_TRACE_EVENT_ISR_EXIT     = 5,    /**<  Interrupt exit  */
+    OS_TRACE_EVENT_LOST         = 7,    /**<  Records were dropped (buffer full)  */
+} OS_TraceEvent_t;
+
+/**
+ * @brief Record header: event type shift
+ * */
+#define OS_TRACE_EVENT_SHIFT            5u
+
+/**
+ * @brief Record header: task priority / ISR id mask
+ * */
+#define OS_TRACE_ID_MASK                0x1Fu
+
+/**
+ * @brief Maximum record size, in bytes (header, timestamp & lost count)
+ * */
+#define OS_TRACE_RECORD_MAX             11u
+
+/**
+ * @brief ISR id of the OS tick interrupt (OS_vidUpdateTasks())
+ * */
+#define OS_TRACE_ISR_TICK               0u
+
+#if (OS_TASK_COUNT > (OS_TRACE_ID_MASK + 1))
+#error "Trace recorder supports at most 32 tasks (OS_TASK_COUNT)"
+#endif
+
+#if (OS_TRACE_BUFFER_SIZE & (OS_TRACE_BUFFER_SIZE - 1))
+#error "OS_TRACE_BUFFER_SIZE must be a power of 2"
+#endif
+
+/**
+ * @brief Trace recorder state (internal)
+ * */
+typedef struct os_trace_state_t {
+    uint32_t    head;               /**<  Write index, free running  */
+    uint32_t    tail;               /**<  Read index, free running  */
+    OS_Cycles_t last;               /**<  Timestamp of the last written record  */
+    uint32_t    lost;               /**<  Records dropped since the last written record  */
+    uint8_t     buffer [OS_TRACE_BUFFER_SIZE];  /**<  Ring buffer  */
+} OS_TraceState_t;
+
+/* ------------------------------------------------------------------------- */
+
+#if OS_USE_TRACE
+
+/**
+ * Trace recorder state (internal)
+ * */
+extern volatile OS_TraceState_t OS_sTraceState;
+
+/**
+ * @brief Reset the trace recorder, discards all records
+ *
+ * @param void
+ *
+ * @return void
+ * */
+void OS_vidTraceReset(void);
+
+/**
+ * @brief Read (and consume) bytes from the trace buffer. A record may be split
+ * between 2 reads, the concatenation of all reads is a valid record stream.
+ *
+ * @param [out] pu8Buffer : buffer to copy records to
+ * @param [in]  u32Size   : size of @p pu8Buffer, in bytes
+ *
+ * @return Number of bytes copied to @p pu8Buffer
+ * */
+uint32_t OS_u32TraceRead(uint8_t * pu8Buffer, uint32_t u32Size);
+
+/**
+ * @brief Write a record to the trace buffer
+ *
+ * @param [in] enEvent : event type
+ * @param [in] u32Id   : task priority or ISR id, [0: 31]
+ *
+ * @return void
+ * */
+void OS_vidTraceRecord(OS_TraceEvent_t enEvent, uint32_t u32Id);
+
+/**
+ * @brief Record an interrupt entry, call at the start of an interrupt handler
+ *
+ * @param [in] u32Id : ISR id, [1: 31] (0 is used by the OS tick)
+ *
+ * @return void
+ * */
+static inline void OS_vidTraceIsrEnter(uint32_t u32Id)
+{
+    OS_vidTraceRecord(OS_TRACE_EVENT_ISR_ENTER, u32Id);
+}
+
+/**
+ * @brief Record an interrupt exit, call at the end of an interrupt handler
+ *
+ * @param [in] u32Id : ISR id, [1: 31] (0 is used by the OS tick)
+ *
+ * @return void
+ * */
+static inline void OS_vidTraceIsrExit(uint32_t u32Id)
+{
+    OS_vidTraceRecord(OS_TRACE_EVENT_ISR_EXIT, u32Id);
+}
+
+#endif /*  OS_USE_TRACE  */
+
+/**@}*/
+
+#endif /* SIMPLE_OS_TRACE_H_ */